@@ -1,147 +1,615 @@
 #include <mpi.h>
+#include <fcntl.h>
+#include <inttypes.h>
 #include <limits.h>
 #include <math.h>
 #include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
+#include <sys/mman.h>
+#include <sys/resource.h>
+#include <sys/stat.h>
 #include <time.h>
+#include <unistd.h>
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+#ifdef __linux__
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#endif
 
+/*
+ * integer type of the vertices and edges (and by default the weights), graphs
+ * with more than 2^31 edges or vertices need the 64 bit build (-DMST_64BIT)
+ */
+#ifdef MST_64BIT
+typedef int64_t Integer;
+#define INTEGER_FORMAT PRId64
+#define INTEGER_MAXIMUM INT64_MAX
+#define INTEGER_MINIMUM INT64_MIN
+#define MPI_GRAPH_INTEGER MPI_INT64_T
+#else
+typedef int Integer;
+#define INTEGER_FORMAT "d"
+#define INTEGER_MAXIMUM INT_MAX
+#define INTEGER_MINIMUM INT_MIN
+#define MPI_GRAPH_INTEGER MPI_INT
+#endif
+
+/*
+ * integer type of the weights, the 16 bit build (-DMST_16BIT_WEIGHT) only
+ * takes weights from 0 to 65535 and stores smaller edges
+ */
+#ifdef MST_16BIT_WEIGHT
+typedef uint16_t Weight;
+#define WEIGHT_FORMAT PRIu16
+#define WEIGHT_MAXIMUM UINT16_MAX
+#define WEIGHT_MINIMUM 0
+#define MPI_GRAPH_WEIGHT MPI_UINT16_T
+#else
+typedef Integer Weight;
+#define WEIGHT_FORMAT INTEGER_FORMAT
+#define WEIGHT_MAXIMUM INTEGER_MAXIMUM
+#define WEIGHT_MINIMUM INTEGER_MINIMUM
+#define MPI_GRAPH_WEIGHT MPI_GRAPH_INTEGER
+#endif
+
+const int ALGORITHMS = 8;
+const int BENCHMARK_SIZES = 3;
+const int BINARY_HEAP = 0;
+const char BINARY_MAGIC[4] = { 'M', 'S', 'T', 'B' };
+const int BUCKET_QUEUE = 3;
+const int BUCKET_QUEUE_RANGE = 1 << 16;
+const int DARY_HEAP = 2;
+const int DECREASE_OPERATION = 2;
 const char EMPTY_FIELD = ' ';
+const int GRID_GRAPH = 0;
+const int LAZY_SORT_CHUNKS = 1024;
 const char HORIZONTAL_EDGE = '-';
 const char VERTICAL_EDGE = '|';
 const char VERTEX = '+';
+const int CACHE_LINE_SIZE = 64;
+const int COUNTING_SORT_RANGE = 1 << 16;
 const int EDGE_MEMBERS = 3;
+const int FIBONACCI_HEAP = 1;
+const int FILTER_KRUSKAL_THRESHOLD = 4096;
+const int MAZE_BAND_EDGES = 1 << 20;
 const int MAXIMUM_RANDOM = 100;
+const int OUTPUT_BUFFER_SIZE = 1 << 20;
+const int PARSE_CHUNK_SIZE = 1 << 20;
+const int POP_OPERATION = 1;
+const int PUSH_OPERATION = 0;
+const int RANDOM_GRAPH = 1;
+const int RMAT_GRAPH = 2;
 const int UNSET_ELEMENT = -1;
 
+/*
+ * timed phases, the phases can nest (Kruskal's merge sorts its edges)
+ */
+typedef enum Phase {
+	READ_PHASE,
+	SCATTER_PHASE,
+	SORT_PHASE,
+	MERGE_PHASE,
+	SCAN_PHASE,
+	REDUCE_PHASE,
+	BROADCAST_PHASE,
+	UNION_PHASE,
+	ADJACENCY_PHASE,
+	HEAP_PHASE,
+	ALGORITHM_PHASE,
+	UPDATE_PHASE,
+	PHASES
+} Phase;
+
+/*
+ * counted events, the bytes are those a process hands to MPI for sending, the
+ * union-find and heap events are in the hot loops and are only counted by the
+ * profiling build (-DMST_PROFILE)
+ */
+typedef enum Counter {
+	FIND_COUNTER,
+	COMPRESSION_COUNTER,
+	DECREASE_COUNTER,
+	BYTE_COUNTER,
+	COUNTERS
+} Counter;
+
+const char* ALGORITHM_NAMES[] = { "kruskal", "primFibonacci", "primBinary",
+		"boruvka", "filterKruskal", "primDary", "primBucket",
+		"boruvkaDistributed" };
+const char* COUNTER_NAMES[] = { "findSet", "compressions", "decreaseKeys",
+		"bytesSent" };
+const char* HEAP_NAMES[] = { "binary", "fibonacci", "dary", "bucket" };
+const char* PHASE_NAMES[] = { "read", "scatter", "sort", "merge", "scan",
+		"reduce", "broadcast", "union", "adjacency", "heap", "algorithm",
+		"update" };
+
 typedef struct Handle {
+	bool benchmark;
+	bool convert;
 	bool create;
+	bool generate;
 	bool help;
+	bool image;
 	bool maze;
+	bool microbenchmark;
+	bool output;
+	bool partition;
+	bool server;
+	bool timings;
+	bool update;
 	bool verbose;
 	int algorithm;
+	int arity;
 	int columns;
+	int edges;
+	int family;
 	int rows;
+	int trials;
+	unsigned int seed;
+	char* binaryFile;
 	char* graphFile;
+	char* imageFile;
+	char* outputFile;
+	char* timingsFile;
+	char* updateFile;
 } Handle;
 
 typedef struct ListElement {
-	int vertex;
-	int weight;
+	Integer vertex;
+	Weight weight;
 } ListElement;
 
-typedef struct List {
-	int alloced;
-	int size;
-	ListElement* elements;
-} List;
-
 typedef struct AdjacencyList {
-	int elements;
-	List* lists;
+	Integer elements;
+	Integer* offsets;
+	ListElement* neighbors;
 } AdjacencyList;
 
 typedef struct Set {
-	int elements;
-	int* canonicalElements;
-	int* rank;
+	Integer elements;
+	Integer* parents;
 } Set;
 
 typedef struct BinaryHeapElement {
-	int vertex;
-	int via;
-	int weight;
+	Integer vertex;
+	Integer via;
+	Integer weight;
 } BinaryHeapElement;
 
 typedef struct BinaryMinHeap {
-	int alloced;
-	int size;
-	int* positions;
+	Integer alloced;
+	Integer size;
+	Integer* positions;
 	BinaryHeapElement* elements;
 } BinaryMinHeap;
 
+typedef struct BucketQueue {
+	Integer minimum;
+	Integer range;
+	Integer current;
+	Integer size;
+	Integer* buckets;
+	Integer* next;
+	Integer* previous;
+	Integer* keys;
+	Integer* vias;
+} BucketQueue;
+
+typedef struct DaryMinHeap {
+	Integer alloced;
+	int arity;
+	Integer size;
+	Integer* keys;
+	Integer* vertices;
+	Integer* vias;
+	Integer* positions;
+} DaryMinHeap;
+
 typedef struct FibonacciHeapElement {
 	bool marked;
-	int childrens;
-	int vertex;
-	int via;
-	int weight;
-	struct FibonacciHeapElement* parent;
-	struct FibonacciHeapElement* child;
-	struct FibonacciHeapElement* left;
-	struct FibonacciHeapElement* right;
+	Integer childrens;
+	Integer vertex;
+	Integer via;
+	Integer weight;
+	Integer parent;
+	Integer child;
+	Integer left;
+	Integer right;
 } FibonacciHeapElement;
 
 typedef struct FibonacciMinHeap {
-	int size;
-	FibonacciHeapElement* minimum;
-	FibonacciHeapElement** positions;
+	Integer alloced;
+	Integer size;
+	Integer used;
+	Integer minimum;
+	Integer* degree;
+	Integer* positions;
+	FibonacciHeapElement* elements;
 } FibonacciMinHeap;
 
+/*
+ * set and heaps kept between the runs of the algorithms, they only grow
+ */
+typedef struct Scratch {
+	Integer setElements;
+	Set set;
+	Integer binaryHeapElements;
+	BinaryMinHeap binaryHeap;
+	FibonacciMinHeap fibonacciHeap;
+} Scratch;
+
+/*
+ * edge of a graph, narrow weights are packed behind the vertices without
+ * padding, so the edges take less memory and are stored as they are in files
+ */
+#ifdef MST_16BIT_WEIGHT
+#pragma pack(push, 2)
+#endif
+typedef struct Edge {
+	Integer from;
+	Integer to;
+	Weight weight;
+} Edge;
+#ifdef MST_16BIT_WEIGHT
+#pragma pack(pop)
+#endif
+
+/*
+ * edge with the components of its endpoints of Boruvka's algorithm
+ */
+typedef struct ContractedEdge {
+	Integer from;
+	Integer to;
+	Edge edge;
+} ContractedEdge;
+
+/*
+ * closest edge of a component of Boruvka's algorithm
+ */
+typedef struct ComponentEdge {
+	Integer component;
+	Edge edge;
+} ComponentEdge;
+
+/*
+ * sample of the sample sort, the process and the position of an edge make the
+ * key (weight, process, position) unique
+ */
+typedef struct Sample {
+	Integer process;
+	Integer position;
+	Weight weight;
+} Sample;
+
 typedef struct WeightedGraph {
-	int edges;
-	int vertices;
-	int* edgeList;
+	bool partitioned;
+	Integer edges;
+	Integer vertices;
+	Edge* edgeList;
+	size_t mappingSize;
+	void* mapping;
 } WeightedGraph;
 
+typedef struct GraphFileHeader {
+	char magic[4];
+	int memberSize;
+	int weightSize;
+	Integer vertices;
+	Integer edges;
+} GraphFileHeader;
+
+/*
+ * push, pop or decrease of a recorded heap trace, pops don't use the vertex,
+ * the via and the weight
+ */
+typedef struct HeapOperation {
+	int type;
+	Integer vertex;
+	Integer via;
+	Integer weight;
+} HeapOperation;
+
+/*
+ * state of an edge before the first update of a batch which touched it
+ */
+typedef struct EdgeChange {
+	Integer edge;
+	bool inTree;
+	Integer from;
+	Integer to;
+	Weight weight;
+} EdgeChange;
+
+/*
+ * MST kept up to date under edge updates, the incidences of an edge (2 * edge
+ * at from, 2 * edge + 1 at to) are linked into a list per vertex, the forest
+ * is a link-cut tree of the vertices and the tree edges (node vertices + edge)
+ * whose splay trees know their heaviest edge, deleted edges are reused after
+ * their batch
+ */
+typedef struct DynamicMst {
+	Integer vertices;
+	Integer edges;
+	Integer alloced;
+	Integer freeEdge;
+	unsigned long weight;
+	Edge* edgeList;
+	uint64_t* inTree;
+	uint64_t* touched;
+	Integer* heads;
+	Integer* next;
+	Integer* previous;
+	Integer* children;
+	Integer* parents;
+	Integer* heaviest;
+	bool* flipped;
+	Integer* stack;
+	Integer* labels;
+	Integer* queue;
+	Integer changes;
+	Integer changesAlloced;
+	EdgeChange* changeList;
+} DynamicMst;
+
+/*
+ * timings in seconds and counters of this process, Boruvka's phases are also
+ * kept for each of its rounds (every round at least halves the components)
+ */
+#define PROFILE_ROUNDS 64
+typedef struct Profile {
+	int rounds;
+	double phases[PHASES];
+	double roundPhases[PROFILE_ROUNDS][PHASES];
+	uint64_t counters[COUNTERS];
+} Profile;
+
+Profile profile;
+
+/*
+ * communicator of the processes working on the graph, all processes except in
+ * the scaling runs of the benchmark
+ */
+MPI_Comm MPI_COMM_GRAPH;
+
+/*
+ * datatype of whole edges in messages and files
+ */
+MPI_Datatype MPI_GRAPH_EDGE;
+
+void accessDynamicMst(DynamicMst* mst, const Integer node);
+Integer addDynamicEdge(DynamicMst* mst, const Integer from, const Integer to,
+		const Weight weight);
+void addSortedEdges(const Edge* edgeList, const Integer edges, Set* set,
+		WeightedGraph* mst, Integer* edgesMST);
+void addUnsortedEdges(const Edge* edgeList, const Integer edges, Set* set,
+		WeightedGraph* mst, Integer* edgesMST);
+void atomicLighterEdge(Integer* closest, const Integer edge,
+		const ContractedEdge* edgeList);
+void atomicMinimumWeight(Weight* closest, const Weight weight);
+int availableThreads();
+bool benchmark(const Handle* handle);
+void broadcastString(char** string);
+void clearBit(uint64_t* bits, const Integer position);
+int compareComponentEdges(const void* edge1, const void* edge2);
+int compareContractedEdges(const void* edge1, const void* edge2);
+int compareDoubles(const void* double1, const void* double2);
+int compareIntegers(const void* integer1, const void* integer2);
+int compareSamples(const void* sample1, const void* sample2);
 void consolidateFibonacciMinHeap(FibonacciMinHeap* heap);
-void copyEdge(int* to, int* from);
+Integer contractEdgeList(ContractedEdge* edgeList, ContractedEdge* buffer,
+		const Integer edges, const Integer* mapping, const Integer components);
+Integer countGeneratedEdges(const int family, const int rows,
+		const int columns, const int edges);
+void countingSort(Edge* edgeList, const Integer elements,
+		const Weight minimum, const Integer range);
+Integer countLines(const char* start, const char* end);
+void countSentBytes(const long count, MPI_Datatype datatype);
 void createMazeFile(const int rows, const int columns,
-		const char outputFileName[]);
-void cutFibonacciMinHeap(FibonacciMinHeap* heap, FibonacciHeapElement* element);
-void decreaseBinaryMinHeap(BinaryMinHeap* heap, const int vertex, const int via,
-		const int weight);
-void decreaseFibonacciMinHeap(FibonacciMinHeap* heap, const int vertex,
-		const int via, const int weight);
+		const unsigned int seed, const char outputFileName[]);
+void cutDynamicMst(DynamicMst* mst, const Integer edge);
+void cutFibonacciMinHeap(FibonacciMinHeap* heap, const Integer element);
+void decreaseBinaryMinHeap(BinaryMinHeap* heap, const Integer vertex,
+		const Integer via, const Integer weight);
+void decreaseBucketQueue(BucketQueue* queue, const Integer vertex,
+		const Integer via, const Integer weight);
+void decreaseDaryMinHeap(DaryMinHeap* heap, const Integer vertex,
+		const Integer via, const Integer weight);
+void decreaseFibonacciMinHeap(FibonacciMinHeap* heap, const Integer vertex,
+		const Integer via, const Integer weight);
 void deleteAdjacencyList(AdjacencyList* list);
 void deleteBinaryMinHeap(BinaryMinHeap* heap);
+void deleteBucketQueue(BucketQueue* queue);
+void deleteDaryMinHeap(DaryMinHeap* heap);
+void deleteDynamicMst(DynamicMst* mst);
 void deleteFibonacciMinHeap(FibonacciMinHeap* heap);
+void deleteScratch(Scratch* scratch);
 void deleteSet(Set* set);
 void deleteWeightedGraph(WeightedGraph* graph);
-int findSet(const Set* set, const int vertex);
-void heapifyBinaryMinHeap(BinaryMinHeap* heap, int position);
-void heapifyDownBinaryMinHeap(BinaryMinHeap* heap, int position);
-void insertFibonacciMinHeap(FibonacciMinHeap* heap,
-		FibonacciHeapElement* element);
-void merge(int* edgeList, const int start, const int end, const int pivot);
-void mergeSort(int* edgeList, const int start, const int end);
-void mstBoruvka(const WeightedGraph* graph, WeightedGraph* mst);
-void mstKruskal(WeightedGraph* graph, WeightedGraph* mst);
-void mstPrimBinary(const WeightedGraph* graph, WeightedGraph* mst);
-void mstPrimFibonacci(const WeightedGraph* graph, WeightedGraph* mst);
+void distributeEdgeList(WeightedGraph* graph);
+void evertDynamicMst(DynamicMst* mst, const Integer node);
+void exchangeClosestEdge(Edge* closestEdge, const Integer components,
+		const Integer* updated, const Integer updatedCount);
+void fillMazeBitmap(uint64_t* bitmap, const WeightedGraph* graph,
+		const int rows, const int columns);
+void filterKruskal(Edge* edgeList, const Integer edges, Set* set,
+		WeightedGraph* mst, Integer* edgesMST);
+Integer findDynamicEdge(const DynamicMst* mst, const Integer from,
+		const Integer to);
+Integer findRootDynamicMst(DynamicMst* mst, const Integer node);
+Integer findSet(const Set* set, const Integer vertex);
+Integer finishBatchDynamicMst(DynamicMst* mst);
+int formatInteger(char* buffer, const Integer value);
+void gatherEdgeList(WeightedGraph* graph);
+void generateEdge(Edge* edge, const long index, const int family,
+		const int rows, const int columns, const unsigned int seed);
+void generateGraph(WeightedGraph* graph, const int family, const int rows,
+		const int columns, const int edges, const unsigned int seed,
+		const bool partitioned);
+bool getBit(const uint64_t* bits, const Integer position);
+void growDynamicMst(DynamicMst* mst);
+void heapifyBinaryMinHeap(BinaryMinHeap* heap, Integer position);
+void heapifyDaryMinHeap(DaryMinHeap* heap, Integer position);
+void heapifyDownBinaryMinHeap(BinaryMinHeap* heap, Integer position);
+void heapifyDownDaryMinHeap(DaryMinHeap* heap, Integer position);
+void insertDynamicMst(DynamicMst* mst, const Integer edge);
+void insertFibonacciMinHeap(FibonacciMinHeap* heap, const Integer element);
+bool isMazePassage(const uint64_t* bitmap, const int columns, const long row,
+		const long column);
+bool isSplayRootDynamicMst(const DynamicMst* mst, const Integer node);
+void lapPhase(const Phase phase, double* lap);
+bool lighterEdge(const Edge* edge1, const Edge* edge2);
+void linkBucketQueue(BucketQueue* queue, const Integer vertex,
+		const Integer bucket);
+void linkDynamicMst(DynamicMst* mst, const Integer edge);
+void linkIncidence(DynamicMst* mst, const Integer incidence,
+		const Integer vertex);
+bool loadGraphFile(WeightedGraph* graph, const char inputFileName[],
+		const bool partitioned);
+void logDynamicEdge(DynamicMst* mst, const Integer edge);
+void lookupOwnedValues(const Integer* keys, Integer* values,
+		const Integer elements, const Integer* ownedValues,
+		const Integer vertices);
+bool mapGraphFile(WeightedGraph* graph, const char inputFileName[]);
+void microbenchmark(const Handle* handle);
+void minimumEdge(void* in, void* inout, int* elements,
+		MPI_Datatype* datatype);
+void mstBoruvka(WeightedGraph* graph, WeightedGraph* mst, Scratch* scratch);
+void mstBoruvkaDistributed(WeightedGraph* graph, WeightedGraph* mst);
+void mstFilterKruskal(WeightedGraph* graph, WeightedGraph* mst,
+		Scratch* scratch);
+void mstKruskal(WeightedGraph* graph, WeightedGraph* mst, Scratch* scratch);
+void mstPrimBinary(const WeightedGraph* graph, WeightedGraph* mst,
+		Scratch* scratch);
+void mstPrimBucket(const WeightedGraph* graph, WeightedGraph* mst,
+		Scratch* scratch);
+void mstPrimDary(const WeightedGraph* graph, WeightedGraph* mst,
+		const int arity);
+void mstPrimFibonacci(const WeightedGraph* graph, WeightedGraph* mst,
+		Scratch* scratch);
+void mstPrimPartitioned(const WeightedGraph* graph, WeightedGraph* mst,
+		void (*prim)(const WeightedGraph*, WeightedGraph*, Scratch*),
+		Scratch* scratch);
+Integer neighborDynamicMst(const DynamicMst* mst, const Integer incidence);
 void newAdjacencyList(AdjacencyList* list, const WeightedGraph* graph);
-void newBinaryMinHeap(BinaryMinHeap* heap);
-void newFibonacciHeapElement(FibonacciHeapElement* element, const int vertex,
-		const int via, const int weight, FibonacciHeapElement* left,
-		FibonacciHeapElement* right, FibonacciHeapElement* parent,
-		FibonacciHeapElement* child);
-void newSet(Set* set, const int elements);
-void newFibonacciMinHeap(FibonacciMinHeap* heap);
-void newWeightedGraph(WeightedGraph* graph, const int vertices, const int edges);
-void popBinaryMinHeap(BinaryMinHeap* heap, int* vertex, int* via, int* weight);
-void popFibonacciMinHeap(FibonacciMinHeap* heap, int* vertex, int* via,
-		int* weight);
+void newBinaryMinHeap(BinaryMinHeap* heap, const Integer elements);
+void newBucketQueue(BucketQueue* queue, const Integer elements,
+		const Integer minimum, const Integer range);
+void newDaryMinHeap(DaryMinHeap* heap, const int arity, const Integer elements);
+void newDynamicMst(DynamicMst* mst, const WeightedGraph* graph,
+		const WeightedGraph* tree);
+void newFibonacciHeapElement(FibonacciHeapElement* element,
+		const Integer vertex, const Integer via, const Integer weight,
+		const Integer left, const Integer right, const Integer parent,
+		const Integer child);
+void newSet(Set* set, const Integer elements);
+void newFibonacciMinHeap(FibonacciMinHeap* heap, const Integer elements);
+MPI_Datatype newRecordType(const int integers, const MPI_Aint offset,
+		MPI_Datatype member, const MPI_Aint size);
+void newWeightedGraph(WeightedGraph* graph, const Integer vertices,
+		const Integer edges);
+int openCacheMissCounter();
+bool parseEdges(const char* start, const char* end, WeightedGraph* graph,
+		const Integer firstEdge);
+bool parseInteger(const char** position, const char* end, Integer* value);
+bool partitionedAlgorithm(const int algorithm);
+void partitionGraph(WeightedGraph* graph);
+int partitionOwner(const Integer elements, const int size,
+		const Integer element);
+void partitionRange(const Integer elements, const int rank, const int size,
+		Integer* start, Integer* elementsPart);
+void popBinaryMinHeap(BinaryMinHeap* heap, Integer* vertex, Integer* via,
+		Integer* weight);
+void popBucketQueue(BucketQueue* queue, Integer* vertex, Integer* via,
+		Integer* weight);
+void popDaryMinHeap(DaryMinHeap* heap, Integer* vertex, Integer* via,
+		Integer* weight);
+void popFibonacciMinHeap(FibonacciMinHeap* heap, Integer* vertex, Integer* via,
+		Integer* weight);
+void primBinary(const WeightedGraph* graph, WeightedGraph* mst,
+		Scratch* scratch);
+void primFibonacci(const WeightedGraph* graph, WeightedGraph* mst,
+		Scratch* scratch);
 void printAdjacencyList(const AdjacencyList* list);
 void printBinaryHeap(const BinaryMinHeap* heap);
 void printFibonacciHeap(const FibonacciMinHeap* heap,
-		FibonacciHeapElement* startElement);
+		const Integer startElement);
 void printMaze(const WeightedGraph* graph, const int rows, const int columns);
+void printMicrobenchmark(const char* workload, const char* family,
+		const char* structure, const long operations, double* times,
+		double* misses, const int trials);
 void printSet(const Set* set);
 void printWeightedGraph(const WeightedGraph* graph);
 Handle processParameters(int argc, char* argv[]);
-void pushAdjacencyList(AdjacencyList* list, const int from, const int to,
-		const int weight);
-void pushBinaryMinHeap(BinaryMinHeap* heap, const int vertex, const int via,
-		const int weight);
-void pushFibonacciMinHeap(FibonacciMinHeap* heap, const int vertex,
-		const int via, const int weight);
-void readGraphFile(WeightedGraph* graph, const char inputFileName[]);
-void scatterEdgeList(int* edgeList, int* edgeListPart, const int elements,
-		int* elementsPart);
-void sort(WeightedGraph* graph);
-void swapBinaryHeapElement(BinaryMinHeap* heap, int position1, int position2);
-void unionSet(Set* set, const int parent1, const int parent2);
+void pushBinaryMinHeap(BinaryMinHeap* heap, const Integer vertex,
+		const Integer via, const Integer weight);
+void pushBucketQueue(BucketQueue* queue, const Integer vertex,
+		const Integer via, const Integer weight);
+void pushDaryMinHeap(DaryMinHeap* heap, const Integer vertex, const Integer via,
+		const Integer weight);
+void pushDynamicMst(DynamicMst* mst, const Integer node);
+void pushFibonacciMinHeap(FibonacciMinHeap* heap, const Integer vertex,
+		const Integer via, const Integer weight);
+uint64_t randomNumber(const uint64_t seed, const uint64_t counter);
+long readCacheMissCounter(const int counter);
+bool readGraphFile(WeightedGraph* graph, const char inputFileName[]);
+bool readGraphFilePart(WeightedGraph* graph, const char inputFileName[],
+		bool* binary);
+bool readJob(Handle* job, char** line, size_t* lineSize);
+Integer recordKruskalTrace(const WeightedGraph* graph, Integer* trace);
+Integer recordPrimTrace(const WeightedGraph* graph, HeapOperation* trace);
+Integer reduceContractedEdges(ContractedEdge* edgeList, const Integer edges);
+void refreshDynamicMst(DynamicMst* mst, const Integer node);
+void removeDynamicMst(DynamicMst* mst, const Integer from, const Integer to);
+void replaceDynamicMst(DynamicMst* mst, const Integer from, const Integer to);
+bool replayHeapTrace(const HeapOperation* trace, const Integer operations,
+		const Integer vertices, const int structure, const int arity,
+		const int counter, double* time, double* misses);
+void replaySetTrace(const Integer* trace, const Integer edges,
+		const Integer vertices, const int counter, double* time,
+		double* misses);
+void rotateDynamicMst(DynamicMst* mst, const Integer node);
+bool runAlgorithm(const Handle* handle, WeightedGraph* graph,
+		WeightedGraph* mst, Scratch* scratch);
+void sampleSort(WeightedGraph* graph);
+void scanSpanningForests(const WeightedGraph* graph, Set* set);
+BinaryMinHeap* scratchBinaryMinHeap(Scratch* scratch, const Integer elements);
+FibonacciMinHeap* scratchFibonacciMinHeap(Scratch* scratch,
+		const Integer elements);
+Set* scratchSet(Scratch* scratch, const Integer elements);
+void serveJobs(const Handle* handle, MPI_Datatype MPI_HANDLE);
+void setBit(uint64_t* bits, const Integer position);
+void sortEdgeList(Edge* edgeList, const Integer elements);
+void sortEdgeListByKey(Edge* edgeList, const Integer elements);
+void splayDynamicMst(DynamicMst* mst, const Integer node);
+void startCacheMissCounter(const int counter);
+long sumCounts(const int* counts, const int size);
+unsigned long sumWeights(const WeightedGraph* graph);
+void swapBinaryHeapElement(BinaryMinHeap* heap, Integer position1,
+		Integer position2);
+void swapEdge(Edge* edge1, Edge* edge2);
+void unionSet(Set* set, const Integer parent1, const Integer parent2);
+void unlinkBucketQueue(BucketQueue* queue, const Integer vertex);
+void unlinkIncidence(DynamicMst* mst, const Integer incidence,
+		const Integer vertex);
+void updateDynamicMst(DynamicMst* mst, const Integer from, const Integer to,
+		const Weight weight);
+void updateMst(const WeightedGraph* graph, WeightedGraph* mst,
+		const char updateFileName[]);
+bool validEdges(const Edge* edgeList, const Integer edges,
+		const Integer vertices);
+bool writeEdges(const WeightedGraph* graph, FILE* outputFile);
+void writeGraphFile(const WeightedGraph* graph, const char outputFileName[]);
+void writeMazeImage(const WeightedGraph* graph, const int rows,
+		const int columns, const char outputFileName[]);
+void writeMstFile(const WeightedGraph* mst, const char outputFileName[]);
+void writeTimingsFile(const char outputFileName[]);
 
 /*
  * main program
@@ -150,19 +618,20 @@ int main(int argc, char* argv[]) {
 	// MPI variables and initialization
 	int rank;
 	int size;
-	MPI_Init(&argc, &argv);
+	int threadSupport;
+	MPI_Init_thread(&argc, &argv, MPI_THREAD_FUNNELED, &threadSupport);
 	MPI_Comm_rank(MPI_COMM_WORLD, &rank);
 	MPI_Comm_size(MPI_COMM_WORLD, &size);
+	MPI_COMM_GRAPH = MPI_COMM_WORLD;
 	MPI_Datatype MPI_HANDLE;
-	int blockCounts[3] = { 4, 3, 1 };
-	MPI_Aint width[3];
-	MPI_Type_extent(MPI_C_BOOL, &width[0]);
-	MPI_Type_extent(MPI_INT, &width[1]);
-	MPI_Type_extent(MPI_UNSIGNED, &width[2]);
-	MPI_Aint offsets[3] = { 0, 4 * width[0], 3 * width[1] };
+	int blockCounts[3] = { 14, 7, 1 };
+	MPI_Aint offsets[3] = { offsetof(Handle, benchmark), offsetof(Handle,
+			algorithm), offsetof(Handle, seed) };
 	MPI_Datatype oldTypes[3] = { MPI_C_BOOL, MPI_INT, MPI_UNSIGNED };
-	MPI_Type_struct(3, blockCounts, offsets, oldTypes, &MPI_HANDLE);
+	MPI_Type_create_struct(3, blockCounts, offsets, oldTypes, &MPI_HANDLE);
 	MPI_Type_commit(&MPI_HANDLE);
+	MPI_GRAPH_EDGE = newRecordType(2, offsetof(Edge, weight), MPI_GRAPH_WEIGHT,
+			sizeof(Edge));
 
 	// control variable
 	Handle handle;
@@ -179,23 +648,81 @@ int main(int argc, char* argv[]) {
 	}
 
 	// graph Variables
-	WeightedGraph* graph = &(WeightedGraph ) { .edges = 0, .vertices = 0,
-					.edgeList = NULL };
-	WeightedGraph* mst = &(WeightedGraph ) { .edges = 0, .vertices = 0,
-					.edgeList = NULL };
+	WeightedGraph* graph = &(WeightedGraph ) { .partitioned = false, .edges =
+					0, .vertices = 0, .edgeList = NULL, .mappingSize = 0,
+					.mapping = NULL };
+	WeightedGraph* mst = &(WeightedGraph ) { .partitioned = false, .edges = 0,
+					.vertices = 0, .edgeList = NULL, .mappingSize = 0,
+					.mapping = NULL };
+
+	if (handle.convert) {
+		if (rank == 0) {
+			// store the graph file in the binary format
+			if (!readGraphFile(graph, handle.graphFile)) {
+				exit(EXIT_FAILURE);
+			}
+			writeGraphFile(graph, handle.binaryFile);
+			deleteWeightedGraph(graph);
+		}
+		MPI_Finalize();
+		exit(EXIT_SUCCESS);
+	}
+
+	if (handle.benchmark) {
+		// sweep the algorithms over generated graphs
+		bool same = benchmark(&handle);
+		MPI_Finalize();
+		exit(same ? EXIT_SUCCESS : EXIT_FAILURE);
+	}
+
+	if (handle.server) {
+		// keep the processes alive and answer jobs until the end of the input
+		serveJobs(&handle, MPI_HANDLE);
+		MPI_Finalize();
+		exit(EXIT_SUCCESS);
+	}
+
+	if (handle.microbenchmark) {
+		if (rank == 0) {
+			// time the heaps and the union-find on recorded operations
+			microbenchmark(&handle);
+		}
+		MPI_Finalize();
+		exit(EXIT_SUCCESS);
+	}
+
+	// the graph file is opened by all processes for parallel reading
+	broadcastString(&handle.graphFile);
 
 	if (rank == 0) {
 		printf("Starting\n");
+	}
 
-		if (handle.create) {
-			// create a new maze file
-			createMazeFile(handle.rows, handle.columns, handle.graphFile);
-		}
+	if (handle.create) {
+		// create a new maze file
+		createMazeFile(handle.rows, handle.columns, handle.seed,
+				handle.graphFile);
+	}
 
-		// read the maze file and store it in the graph
-		readGraphFile(graph, handle.graphFile);
+	// Kruskal and Boruvka only need each process to hold its part of the edges
+	bool partitionedInput = partitionedAlgorithm(handle.algorithm);
+	if (partitionedInput && !handle.generate) {
+		MPI_Barrier(MPI_COMM_GRAPH);
+	}
+	double lap = MPI_Wtime();
+	if (handle.generate) {
+		// build the graph in memory instead of reading a file
+		generateGraph(graph, handle.family, handle.rows, handle.columns,
+				handle.edges, handle.seed, partitionedInput);
+	} else if (!loadGraphFile(graph, handle.graphFile, partitionedInput)) {
+		// every process gives up on an unreadable maze file
+		MPI_Finalize();
+		exit(EXIT_FAILURE);
+	}
+	lapPhase(READ_PHASE, &lap);
 
-		if (handle.verbose) {
+	if (rank == 0) {
+		if (handle.verbose && !graph->partitioned) {
 			// print the edges of the read graph
 			printf("Graph:\n");
 			printWeightedGraph(graph);
@@ -204,25 +731,10 @@ int main(int argc, char* argv[]) {
 		newWeightedGraph(mst, graph->vertices, graph->vertices - 1);
 	}
 
+	Scratch* scratch = &(Scratch ) { .setElements = 0, .binaryHeapElements =
+					0 };
 	double start = MPI_Wtime();
-	switch (handle.algorithm) {
-	case 0:
-		// use Kruskal's algorithm
-		mstKruskal(graph, mst);
-		break;
-	case 1:
-		// use Prim's algorithm (fibonacci)
-		mstPrimFibonacci(graph, mst);
-		break;
-	case 2:
-		// use Prim's algorithm (binary)
-		mstPrimBinary(graph, mst);
-		break;
-	case 3:
-		// use Boruvka's algorithm
-		mstBoruvka(graph, mst);
-		break;
-	default:
+	if (!runAlgorithm(&handle, graph, mst, scratch)) {
 		if (rank == 0) {
 			fprintf(stderr, "Unknown algorithm: %d\n"
 					"-h for help\n", handle.algorithm);
@@ -230,9 +742,30 @@ int main(int argc, char* argv[]) {
 		MPI_Finalize();
 		exit(EXIT_FAILURE);
 	}
+	lapPhase(ALGORITHM_PHASE, &start);
+
+	if (handle.update) {
+		if (graph->partitioned) {
+			// the updates need all edges on the first process
+			deleteWeightedGraph(graph);
+			*graph = (WeightedGraph ) { .partitioned = false, .edges = 0,
+							.vertices = 0, .edgeList = NULL, .mappingSize = 0,
+							.mapping = NULL };
+			if (handle.generate) {
+				generateGraph(graph, handle.family, handle.rows,
+						handle.columns, handle.edges, handle.seed, false);
+			} else if (rank == 0 && !readGraphFile(graph, handle.graphFile)) {
+				exit(EXIT_FAILURE);
+			}
+		}
+		if (rank == 0) {
+			// apply the batches of edge updates to the MST
+			updateMst(graph, mst, handle.updateFile);
+		}
+	}
 
 	if (rank == 0) {
-		printf("Time elapsed: %f s\n", MPI_Wtime() - start);
+		printf("Time elapsed: %f s\n", profile.phases[ALGORITHM_PHASE]);
 
 		if (handle.verbose) {
 			// print the edges of the MST
@@ -240,11 +773,16 @@ int main(int argc, char* argv[]) {
 			printWeightedGraph(mst);
 		}
 
-		unsigned long weightMST = 0;
-		for (int i = 0; i < mst->edges; i++) {
-			weightMST += mst->edgeList[i * EDGE_MEMBERS + 2];
+		printf("MST weight: %lu\n", sumWeights(mst));
+		if (mst->edges < graph->vertices - 1) {
+			printf("MST components: %" INTEGER_FORMAT "\n",
+					graph->vertices - mst->edges);
+		}
+
+		if (handle.output) {
+			// write the MST to a file
+			writeMstFile(mst, handle.outputFile);
 		}
-		printf("MST weight: %lu\n", weightMST);
 
 		if (handle.maze) {
 			// print the maze to the console
@@ -252,1288 +790,5688 @@ int main(int argc, char* argv[]) {
 			printMaze(mst, handle.rows, handle.columns);
 		}
 
-		// cleanup
-		deleteWeightedGraph(graph);
-		deleteWeightedGraph(mst);
+		if (handle.image) {
+			// write the maze to an image file
+			writeMazeImage(mst, handle.rows, handle.columns, handle.imageFile);
+		}
 
 		printf("Finished\n");
 	}
 
+	if (handle.timings) {
+		// reduce the timings and counters of all processes
+		writeTimingsFile(handle.timingsFile);
+	}
+
+	// cleanup
+	deleteWeightedGraph(graph);
+	deleteWeightedGraph(mst);
+	deleteScratch(scratch);
+	if (rank != 0) {
+		free(handle.graphFile);
+	}
+
 	MPI_Finalize();
 
 	return EXIT_SUCCESS;
 }
 
 /*
- * rearrange fibonacci heap and update minimum
+ * make the path from the root of the link-cut tree to the node the preferred
+ * path, the node ends up as root of its splay tree with the whole path in it
  */
-void consolidateFibonacciMinHeap(FibonacciMinHeap* heap) {
-	// initialize degree array
-	int degreeSize = 2 * log2(heap->size) + 1;
-	FibonacciHeapElement** degree = (FibonacciHeapElement**) malloc(
-			degreeSize * sizeof(FibonacciHeapElement*));
-	for (int i = 0; i < degreeSize; i++) {
-		degree[i] = NULL;
+void accessDynamicMst(DynamicMst* mst, const Integer node) {
+	Integer last = UNSET_ELEMENT;
+	for (Integer i = node; i != UNSET_ELEMENT; i = mst->parents[i]) {
+		splayDynamicMst(mst, i);
+		mst->children[2 * i + 1] = last;
+		refreshDynamicMst(mst, i);
+		last = i;
 	}
+	splayDynamicMst(mst, node);
+}
 
-	// add roots to degree array
-	FibonacciHeapElement* element = heap->minimum;
-	FibonacciHeapElement* nextElement = NULL;
-	do {
-		if (element == element->right) {
-			nextElement = NULL;
-		} else {
-			nextElement = element->right;
-		}
-		element->right->left = element->left;
-		element->left->right = element->right;
-		element->right = element;
-		element->left = element;
-		int currentDegree = element->childrens;
-		while (degree[currentDegree] != NULL) {
-			if (element->weight > degree[currentDegree]->weight) {
-				FibonacciHeapElement* tmp = element;
-				element = degree[currentDegree];
-				degree[currentDegree] = tmp;
-			}
-
-			// degree[currentDegree] becomes child of element
-			if (element->child == NULL) {
-				element->child = degree[currentDegree];
-				degree[currentDegree]->parent = element;
-			} else {
-				degree[currentDegree]->parent = element;
-				degree[currentDegree]->right = element->child;
-				degree[currentDegree]->left = element->child->left;
-				degree[currentDegree]->right->left = degree[currentDegree];
-				degree[currentDegree]->left->right = degree[currentDegree];
-			}
-			element->childrens++;
-			degree[currentDegree]->marked = false;
-			degree[currentDegree] = NULL;
-			currentDegree++;
+/*
+ * add an edge which isn't in the tree to the lists of its vertices, returns
+ * the edge
+ */
+Integer addDynamicEdge(DynamicMst* mst, const Integer from, const Integer to,
+		const Weight weight) {
+	Integer edge = mst->freeEdge;
+	if (edge != UNSET_ELEMENT) {
+		// the free edges are linked by their first incidence
+		mst->freeEdge = mst->next[2 * edge];
+	} else {
+		if (mst->edges == mst->alloced) {
+			growDynamicMst(mst);
 		}
-		degree[currentDegree] = element;
+		edge = mst->edges++;
+	}
 
-		element = nextElement;
-	} while (element != NULL);
+	mst->edgeList[edge] = (Edge ) { .from = from, .to = to, .weight = weight };
+	clearBit(mst->inTree, edge);
+	linkIncidence(mst, 2 * edge, from);
+	linkIncidence(mst, 2 * edge + 1, to);
 
-	// update minimum
-	heap->minimum = NULL;
-	for (int i = 0; i < degreeSize; i++) {
-		if (degree[i] != NULL) {
-			if (heap->minimum == NULL) {
-				// heap empty
-				heap->minimum = degree[i];
-				degree[i]->right = degree[i];
-				degree[i]->left = degree[i];
-			} else {
-				degree[i]->right = heap->minimum;
-				degree[i]->left = heap->minimum->left;
-				heap->minimum->left->right = degree[i];
-				heap->minimum->left = degree[i];
-				if (degree[i]->weight < heap->minimum->weight) {
-					// less weight then current minimum
-					heap->minimum = degree[i];
-				}
-			}
-		}
-	}
+	// the edge starts as a link-cut tree of its own
+	Integer node = mst->vertices + edge;
+	mst->children[2 * node] = UNSET_ELEMENT;
+	mst->children[2 * node + 1] = UNSET_ELEMENT;
+	mst->parents[node] = UNSET_ELEMENT;
+	mst->heaviest[node] = node;
+	mst->flipped[node] = false;
 
-	free(degree);
+	return edge;
 }
 
 /*
- * copy an edge
+ * add the edges of a sorted edge list to the MST in order if they don't
+ * close a cycle, stops when the MST is complete
  */
-void copyEdge(int* to, int* from) {
-	memcpy(to, from, EDGE_MEMBERS * sizeof(int));
+void addSortedEdges(const Edge* edgeList, const Integer edges, Set* set,
+		WeightedGraph* mst, Integer* edgesMST) {
+	for (Integer i = 0; i < edges && *edgesMST < mst->vertices - 1; i++) {
+		// check for loops if edge would be inserted
+		Integer canonicalElementFrom = findSet(set, edgeList[i].from);
+		Integer canonicalElementTo = findSet(set, edgeList[i].to);
+		if (canonicalElementFrom != canonicalElementTo) {
+			// add edge to MST
+			mst->edgeList[*edgesMST] = edgeList[i];
+			unionSet(set, canonicalElementFrom, canonicalElementTo);
+			(*edgesMST)++;
+		}
+	}
 }
 
 /*
- * save a 2D (rows x columns) grid graph with random edge weights to a file
+ * add the MST edges of an unsorted edge list, the edges are split into chunks
+ * of weight ranges and a chunk is only sorted when the scan reaches it
  */
-void createMazeFile(const int rows, const int columns,
-		const char outputFileName[]) {
-	// open the file
-	FILE* outputFile;
-	const char* outputMode = "w";
-	outputFile = fopen(outputFileName, outputMode);
-	if (outputFile == NULL) {
-		fprintf(stderr, "Couldn't open output file, exiting!\n");
-		exit(EXIT_FAILURE);
+void addUnsortedEdges(const Edge* edgeList, const Integer edges, Set* set,
+		WeightedGraph* mst, Integer* edgesMST) {
+	if (edges == 0) {
+		return;
 	}
 
-	// first line contains number of vertices and edges
-	const int vertices = rows * columns;
-	const int edges = vertices * 2 - rows - columns;
-	fprintf(outputFile, "%d %d\n", vertices, edges);
-
-	// all lines after the first contain the edges, values stored as "from to weight"
-	srand(time(NULL));
-	for (int i = 0; i < rows; i++) {
-		for (int j = 0; j < columns; j++) {
-			int vertex = i * columns + j;
-			int fprintfResult;
-			if (j != columns - 1) {
-				fprintfResult = fprintf(outputFile, "%d %d %d\n", vertex,
-						vertex + 1, rand() % MAXIMUM_RANDOM);
-			}
-			if (i != rows - 1) {
-				fprintfResult = fprintf(outputFile, "%d %d %d\n", vertex,
-						vertex + columns, rand() % MAXIMUM_RANDOM);
-			}
-
-			// EOF result of *scanf indicates an error
-			if (fprintfResult < 0) {
-				fprintf(stderr,
-						"Something went wrong during writing of maze file, exiting!\n");
-				fclose(outputFile);
-				exit(EXIT_FAILURE);
-			}
+	// observed weight range
+	Weight minimum = WEIGHT_MAXIMUM;
+	Weight maximum = WEIGHT_MINIMUM;
+	for (Integer i = 0; i < edges; i++) {
+		Weight weight = edgeList[i].weight;
+		minimum = weight < minimum ? weight : minimum;
+		maximum = weight > maximum ? weight : maximum;
+	}
+	// the span of 64 bit weights only fits unsigned, a chunk covers an equal
+	// share of it that is computed without a multiplication
+	uint64_t span = (uint64_t) maximum - (uint64_t) minimum;
+	int chunks = span < (uint64_t) LAZY_SORT_CHUNKS ?
+			span + 1 : LAZY_SORT_CHUNKS;
+	uint64_t width = span / chunks + 1;
+
+	// count the edges of each chunk, a chunk starts behind all lighter chunks
+	Integer* chunkStart = (Integer*) calloc(chunks + 1, sizeof(Integer));
+	for (Integer i = 0; i < edges; i++) {
+		chunkStart[((uint64_t) edgeList[i].weight - (uint64_t) minimum) / width
+				+ 1]++;
+	}
+	for (int i = 0; i < chunks; i++) {
+		chunkStart[i + 1] += chunkStart[i];
+	}
+
+	// move the edges into their chunks
+	Edge* working = (Edge*) malloc((size_t) edges * sizeof(Edge));
+	Integer* positions = (Integer*) malloc(chunks * sizeof(Integer));
+	memcpy(positions, chunkStart, chunks * sizeof(Integer));
+	for (Integer i = 0; i < edges; i++) {
+		Integer chunk = ((uint64_t) edgeList[i].weight - (uint64_t) minimum)
+				/ width;
+		working[positions[chunk]++] = edgeList[i];
+	}
+
+	// sort and scan the chunks in order until the MST is complete
+	for (Integer i = 0; i < chunks && *edgesMST < mst->vertices - 1; i++) {
+		Edge* chunk = &working[chunkStart[i]];
+		Integer chunkEdges = chunkStart[i + 1] - chunkStart[i];
+		if (width > 1) {
+			// chunks with more than one weight
+			sortEdgeList(chunk, chunkEdges);
 		}
+		addSortedEdges(chunk, chunkEdges, set, mst, edgesMST);
 	}
 
-	fclose(outputFile);
+	// clean up
+	free(chunkStart);
+	free(positions);
+	free(working);
 }
 
 /*
- * cut an element from a fibonacci heap
+ * replace the index of the closest contracted edge by the given index if that
+ * edge is lighter, safe between threads
  */
-void cutFibonacciMinHeap(FibonacciMinHeap* heap, FibonacciHeapElement* element) {
-	FibonacciHeapElement* parent = element->parent;
-	if (parent != NULL) {
-		parent->childrens--;
-	}
-	if (element->right == element) {
-		// only one element in the child list
-		parent->child = NULL;
-	} else {
-		element->right->left = element->left;
-		element->left->right = element->right;
-		if (parent->child == element) {
-			// update parents child pointer
-			parent->child = element->right;
-		}
+void atomicLighterEdge(Integer* closest, const Integer edge,
+		const ContractedEdge* edgeList) {
+	Integer current = __atomic_load_n(closest, __ATOMIC_RELAXED);
+	while ((current == UNSET_ELEMENT
+			|| lighterEdge(&edgeList[edge].edge, &edgeList[current].edge))
+			&& !__atomic_compare_exchange_n(closest, &current, edge, true,
+					__ATOMIC_RELAXED, __ATOMIC_RELAXED)) {
+		// current now holds the index of another thread, try again
 	}
+}
 
-	// insert as new root element
-	insertFibonacciMinHeap(heap, element);
-	element->parent = NULL;
-
-	if (parent->parent != NULL) {
-		// not a root element
-		if (parent->marked) {
-			// recursively cut marked parent
-			cutFibonacciMinHeap(heap, parent);
-			parent->marked = false;
-		} else {
-			parent->marked = true;
-		}
+/*
+ * replace the weight of the closest edge by the given weight if it is lower,
+ * safe between threads
+ */
+void atomicMinimumWeight(Weight* closest, const Weight weight) {
+	Weight current = __atomic_load_n(closest, __ATOMIC_RELAXED);
+	while (weight < current
+			&& !__atomic_compare_exchange_n(closest, &current, weight, true,
+					__ATOMIC_RELAXED, __ATOMIC_RELAXED)) {
+		// current now holds the weight of another thread, try again
 	}
 }
 
 /*
- * only decrease the weight to a given vertex
+ * number of threads available for parallel loops of this process
  */
-void decreaseBinaryMinHeap(BinaryMinHeap* heap, const int vertex, const int via,
-		const int weight) {
-	if (heap->positions[vertex] != UNSET_ELEMENT
-			&& heap->elements[heap->positions[vertex]].weight > weight) {
-		heap->elements[heap->positions[vertex]].via = via;
-		heap->elements[heap->positions[vertex]].weight = weight;
-		heapifyBinaryMinHeap(heap, heap->positions[vertex]);
-	}
+int availableThreads() {
+#ifdef _OPENMP
+	return omp_get_max_threads();
+#else
+	return 1;
+#endif
 }
 
 /*
- * only decrease the weight to a given vertex
+ * run every algorithm on generated grids, sparse and dense random graphs and
+ * R-MAT graphs of growing sizes with growing numbers of processes, for strong
+ * scaling the graph stays the same and for weak scaling its rows grow with the
+ * processes, the first process prints a CSV line for every configuration with
+ * the median and 95th percentile time of the trials after a warm-up run, the
+ * throughput, the peak memory of a process so far and the MST weight, which
+ * has to be the same for all algorithms, returns false if it isn't
  */
-void decreaseFibonacciMinHeap(FibonacciMinHeap* heap, const int vertex,
-		const int via, const int weight) {
-	FibonacciHeapElement* element = heap->positions[vertex];
-	if (element != NULL && element->weight > weight) {
-		element->via = via;
-		element->weight = weight;
-		if (element->parent == NULL) {
-			if (element->weight < heap->minimum->weight) {
-				heap->minimum = element;
+bool benchmark(const Handle* handle) {
+	int rank;
+	int size;
+	MPI_Comm_rank(MPI_COMM_WORLD, &rank);
+	MPI_Comm_size(MPI_COMM_WORLD, &size);
+
+	// dense random graphs have 16 edges per vertex, the others their default
+	const char* familyNames[] = { "grid", "sparse", "dense", "rmat" };
+	const int families[] = { GRID_GRAPH, RANDOM_GRAPH, RANDOM_GRAPH,
+			RMAT_GRAPH };
+	const int degrees[] = { 0, 0, 16, 0 };
+
+	if (rank == 0) {
+		printf("scaling,family,processes,vertices,edges,algorithm,median,p95,"
+				"edgesPerSecond,peakRssKiB,weight,sameWeight\n");
+	}
+	bool same = true;
+	double* times = (double*) malloc(handle->trials * sizeof(double));
+	for (int weak = 0; weak < 2; weak++) {
+		for (int family = 0; family < 4; family++) {
+			for (int scale = 0; scale < (weak ? 1 : BENCHMARK_SIZES); scale++) {
+				for (int processes = 1; processes <= size;
+						processes = processes < size && 2 * processes > size ?
+								size : 2 * processes) {
+					// only the first processes work on the graph
+					MPI_Comm_split(MPI_COMM_WORLD, rank < processes ? 0 :
+							MPI_UNDEFINED, rank, &MPI_COMM_GRAPH);
+					if (MPI_COMM_GRAPH == MPI_COMM_NULL) {
+						continue;
+					}
+
+					Handle run = *handle;
+					run.rows = weak ? handle->rows * processes :
+							handle->rows << scale;
+					long edges = (long) degrees[family] * run.rows
+							* run.columns;
+					run.edges = edges > INT_MAX ? INT_MAX : edges;
+					run.family = families[family];
+					Integer vertices = (Integer) run.rows * run.columns;
+					Integer edgesGraph = countGeneratedEdges(run.family,
+							run.rows, run.columns, run.edges);
+					unsigned long weightFirst = 0;
+					for (run.algorithm = 0; run.algorithm < ALGORITHMS;
+							run.algorithm++) {
+						unsigned long weight = 0;
+						for (int trial = -1; trial < handle->trials; trial++) {
+							// every trial gets a new copy of the graph and new
+							// scratch, the first one warms up
+							WeightedGraph* graph = &(WeightedGraph ) {
+											.partitioned = false, .edges = 0,
+											.vertices = 0, .edgeList = NULL,
+											.mappingSize = 0, .mapping = NULL };
+							WeightedGraph* mst = &(WeightedGraph ) {
+											.partitioned = false, .edges = 0,
+											.vertices = 0, .edgeList = NULL,
+											.mappingSize = 0, .mapping = NULL };
+							Scratch* scratch = &(Scratch ) { .setElements = 0,
+											.binaryHeapElements = 0 };
+							generateGraph(graph, run.family, run.rows,
+									run.columns, run.edges, run.seed,
+									partitionedAlgorithm(run.algorithm));
+							if (rank == 0) {
+								newWeightedGraph(mst, vertices, vertices - 1);
+							}
+
+							MPI_Barrier(MPI_COMM_GRAPH);
+							double start = MPI_Wtime();
+							runAlgorithm(&run, graph, mst, scratch);
+							double elapsed = MPI_Wtime() - start;
+							double slowest;
+							MPI_Reduce(&elapsed, &slowest, 1, MPI_DOUBLE,
+									MPI_MAX, 0, MPI_COMM_GRAPH);
+							if (trial >= 0) {
+								times[trial] = slowest;
+							}
+							if (rank == 0) {
+								weight = sumWeights(mst);
+							}
+
+							deleteWeightedGraph(graph);
+							deleteWeightedGraph(mst);
+							deleteScratch(scratch);
+						}
+
+						struct rusage usage;
+						getrusage(RUSAGE_SELF, &usage);
+						long peak;
+						MPI_Reduce(&usage.ru_maxrss, &peak, 1, MPI_LONG, MPI_MAX,
+								0, MPI_COMM_GRAPH);
+						if (rank == 0) {
+							if (run.algorithm == 0) {
+								weightFirst = weight;
+							}
+							same = same && weight == weightFirst;
+							qsort(times, handle->trials, sizeof(double),
+									compareDoubles);
+							double median = (times[(handle->trials - 1) / 2]
+									+ times[handle->trials / 2]) / 2;
+							double p95 = times[(int) ceil(
+									0.95 * handle->trials) - 1];
+							printf("%s,%s,%d,%" INTEGER_FORMAT ",%"
+									INTEGER_FORMAT ",%s,%f,%f,%f,%ld,%lu,%s\n",
+									weak ? "weak" : "strong",
+									familyNames[family], processes, vertices,
+									edgesGraph, ALGORITHM_NAMES[run.algorithm],
+									median, p95, edgesGraph / median, peak,
+									weight,
+									weight == weightFirst ? "true" : "false");
+							fflush(stdout);
+						}
+					}
+					MPI_Comm_free(&MPI_COMM_GRAPH);
+				}
 			}
-		} else if (weight < element->parent->weight) {
-			// if heap property is violated cut off the element
-			cutFibonacciMinHeap(heap, element);
 		}
 	}
+	MPI_COMM_GRAPH = MPI_COMM_WORLD;
+
+	if (rank == 0 && !same) {
+		fprintf(stderr, "The algorithms found different MST weights!\n");
+	}
+
+	// clean up
+	free(times);
+
+	return same;
 }
 
 /*
- * cleanup adjacency list data
+ * send a string from the first process to all other processes, the string is
+ * allocated on the receiving processes
  */
-void deleteAdjacencyList(AdjacencyList* list) {
-	for (int i = 0; i < list->elements; i++) {
-		free(list->lists[i].elements);
+void broadcastString(char** string) {
+	int rank;
+	MPI_Comm_rank(MPI_COMM_GRAPH, &rank);
+
+	int length;
+	if (rank == 0) {
+		length = strlen(*string) + 1;
 	}
-	free(list->lists);
+	MPI_Bcast(&length, 1, MPI_INT, 0, MPI_COMM_GRAPH);
+	if (rank != 0) {
+		*string = (char*) malloc(length * sizeof(char));
+	}
+	MPI_Bcast(*string, length, MPI_CHAR, 0, MPI_COMM_GRAPH);
 }
 
 /*
- * cleanup binary heap data
+ * clear a bit of a bit array
  */
-void deleteBinaryMinHeap(BinaryMinHeap* heap) {
-	free(heap->elements);
-	free(heap->positions);
+void clearBit(uint64_t* bits, const Integer position) {
+	bits[position / 64] &= ~(1ULL << (position % 64));
 }
 
 /*
- * cleanup fibonacci heap data
+ * compare two contracted edges by the component of their first endpoint, then
+ * by the edges
  */
-void deleteFibonacciMinHeap(FibonacciMinHeap* heap) {
-	free(heap->positions);
+int compareComponentEdges(const void* edge1, const void* edge2) {
+	const ContractedEdge* contracted1 = (const ContractedEdge*) edge1;
+	const ContractedEdge* contracted2 = (const ContractedEdge*) edge2;
+	if (contracted1->from != contracted2->from) {
+		return contracted1->from < contracted2->from ? -1 : 1;
+	} else if (lighterEdge(&contracted1->edge, &contracted2->edge)) {
+		return -1;
+	} else {
+		return lighterEdge(&contracted2->edge, &contracted1->edge) ? 1 : 0;
+	}
 }
 
 /*
- * cleanup set data
+ * compare two contracted edges by the components of both endpoints, then by
+ * the edges
  */
-void deleteSet(Set* set) {
-	free(set->canonicalElements);
-	free(set->rank);
+int compareContractedEdges(const void* edge1, const void* edge2) {
+	const ContractedEdge* contracted1 = (const ContractedEdge*) edge1;
+	const ContractedEdge* contracted2 = (const ContractedEdge*) edge2;
+	if (contracted1->from == contracted2->from
+			&& contracted1->to != contracted2->to) {
+		return contracted1->to < contracted2->to ? -1 : 1;
+	} else {
+		// different first components or the same pair of components
+		return compareComponentEdges(edge1, edge2);
+	}
 }
 
 /*
- * cleanup graph data
+ * compare two doubles
  */
-void deleteWeightedGraph(WeightedGraph* graph) {
-	free(graph->edgeList);
+int compareDoubles(const void* double1, const void* double2) {
+	double value1 = *(const double*) double1;
+	double value2 = *(const double*) double2;
+	return value1 < value2 ? -1 : value1 > value2;
 }
 
 /*
- * return the canonical element of a vertex with path compression
+ * compare two integers
  */
-int findSet(const Set* set, const int vertex) {
-	if (set->canonicalElements[vertex] == UNSET_ELEMENT) {
-		return vertex;
-	} else {
-		set->canonicalElements[vertex] = findSet(set,
-				set->canonicalElements[vertex]);
-		return set->canonicalElements[vertex];
-	}
+int compareIntegers(const void* integer1, const void* integer2) {
+	Integer value1 = *(const Integer*) integer1;
+	Integer value2 = *(const Integer*) integer2;
+	return value1 < value2 ? -1 : value1 > value2;
 }
 
 /*
- * check and restore heap property from given position upwards
+ * compare two sample sort keys (weight, process, position) lexicographically
  */
-void heapifyBinaryMinHeap(BinaryMinHeap* heap, int position) {
-	while (position >= 0) {
-		int positionParent = (position - 1) / 2;
-		if (heap->elements[position].weight
-				< heap->elements[positionParent].weight) {
-			swapBinaryHeapElement(heap, position, positionParent);
-			position = positionParent;
-		} else {
-			break;
-		}
+int compareSamples(const void* sample1, const void* sample2) {
+	const Sample* key1 = (const Sample*) sample1;
+	const Sample* key2 = (const Sample*) sample2;
+	if (key1->weight != key2->weight) {
+		return key1->weight < key2->weight ? -1 : 1;
+	} else if (key1->process != key2->process) {
+		return key1->process < key2->process ? -1 : 1;
+	} else if (key1->position != key2->position) {
+		return key1->position < key2->position ? -1 : 1;
 	}
+	return 0;
 }
 
 /*
- * check and restore heap property from given position upwards
+ * rearrange fibonacci heap and update minimum
  */
-void heapifyDownBinaryMinHeap(BinaryMinHeap* heap, int position) {
-	while (position < heap->size) {
-		int positionLeft = (position + 1) * 2 - 1;
-		int positionRight = (position + 1) * 2;
-		int positionSmallest = position;
-		if (positionLeft <= heap->size
-				&& heap->elements[positionLeft].weight
-						< heap->elements[positionSmallest].weight) {
-			positionSmallest = positionLeft;
-		}
-		if (positionRight <= heap->size
-				&& heap->elements[positionRight].weight
-						< heap->elements[positionSmallest].weight) {
-			positionSmallest = positionRight;
-		}
-		if (heap->elements[position].weight
-				> heap->elements[positionSmallest].weight) {
-			swapBinaryHeapElement(heap, position, positionSmallest);
-			position = positionSmallest;
+void consolidateFibonacciMinHeap(FibonacciMinHeap* heap) {
+	FibonacciHeapElement* elements = heap->elements;
+
+	// initialize degree array
+	int degreeSize = 2 * log2(heap->size) + 1;
+	Integer* degree = heap->degree;
+	for (int i = 0; i < degreeSize; i++) {
+		degree[i] = UNSET_ELEMENT;
+	}
+
+	// add roots to degree array
+	Integer element = heap->minimum;
+	Integer nextElement = UNSET_ELEMENT;
+	do {
+		if (element == elements[element].right) {
+			nextElement = UNSET_ELEMENT;
 		} else {
-			break;
+			nextElement = elements[element].right;
 		}
-	}
-}
+		elements[elements[element].right].left = elements[element].left;
+		elements[elements[element].left].right = elements[element].right;
+		elements[element].right = element;
+		elements[element].left = element;
+		Integer currentDegree = elements[element].childrens;
+		while (degree[currentDegree] != UNSET_ELEMENT) {
+			if (elements[element].weight
+					> elements[degree[currentDegree]].weight) {
+				Integer tmp = element;
+				element = degree[currentDegree];
+				degree[currentDegree] = tmp;
+			}
 
-/*
- * merge element into fibonacci heap left to the minimum
- */
-void insertFibonacciMinHeap(FibonacciMinHeap* heap,
-		FibonacciHeapElement* element) {
-	if (heap->minimum == NULL) {
-		heap->minimum = element;
-	} else {
-		FibonacciHeapElement* endHeap = heap->minimum->left;
-		heap->minimum->left = element;
-		element->left = endHeap;
-		endHeap->right = element;
-		element->right = heap->minimum;
+			// degree[currentDegree] becomes child of element
+			FibonacciHeapElement* child = &elements[degree[currentDegree]];
+			if (elements[element].child == UNSET_ELEMENT) {
+				elements[element].child = degree[currentDegree];
+				child->parent = element;
+			} else {
+				child->parent = element;
+				child->right = elements[element].child;
+				child->left = elements[elements[element].child].left;
+				elements[child->right].left = degree[currentDegree];
+				elements[child->left].right = degree[currentDegree];
+			}
+			elements[element].childrens++;
+			child->marked = false;
+			degree[currentDegree] = UNSET_ELEMENT;
+			currentDegree++;
+		}
+		degree[currentDegree] = element;
 
-		// set new minimum
-		if (heap->minimum->weight > element->weight) {
-			heap->minimum = element;
+		element = nextElement;
+	} while (element != UNSET_ELEMENT);
+
+	// update minimum
+	heap->minimum = UNSET_ELEMENT;
+	for (int i = 0; i < degreeSize; i++) {
+		if (degree[i] != UNSET_ELEMENT) {
+			if (heap->minimum == UNSET_ELEMENT) {
+				// heap empty
+				heap->minimum = degree[i];
+				elements[degree[i]].right = degree[i];
+				elements[degree[i]].left = degree[i];
+			} else {
+				elements[degree[i]].right = heap->minimum;
+				elements[degree[i]].left = elements[heap->minimum].left;
+				elements[elements[heap->minimum].left].right = degree[i];
+				elements[heap->minimum].left = degree[i];
+				if (elements[degree[i]].weight
+						< elements[heap->minimum].weight) {
+					// less weight then current minimum
+					heap->minimum = degree[i];
+				}
+			}
 		}
 	}
 }
 
 /*
- * merge sorted lists, start and end are inclusive
+ * replace the endpoints of the contracted edges by their new components, drop
+ * the edges inside a component and keep only the lightest edge between two
+ * components, return the number of remaining edges
  */
-void merge(int* edgeList, const int start, const int end, const int pivot) {
-	int length = end - start + 1;
-	int* working = (int*) malloc(length * EDGE_MEMBERS * sizeof(int));
-
-	// copy first part
-	memcpy(working, &edgeList[start * EDGE_MEMBERS],
-			(pivot - start + 1) * EDGE_MEMBERS * sizeof(int));
+Integer contractEdgeList(ContractedEdge* edgeList, ContractedEdge* buffer,
+		const Integer edges, const Integer* mapping, const Integer components) {
+	Integer* counts = (Integer*) calloc(components + 1, sizeof(Integer));
+
+	// relabel the endpoints, the smaller component comes first
+	Integer kept = 0;
+	for (Integer i = 0; i < edges; i++) {
+		Integer from = mapping[edgeList[i].from];
+		Integer to = mapping[edgeList[i].to];
+		if (from != to) {
+			ContractedEdge* keptEdge = &edgeList[kept];
+			keptEdge->edge = edgeList[i].edge;
+			keptEdge->from = from < to ? from : to;
+			keptEdge->to = from < to ? to : from;
+			counts[keptEdge->from + 1]++;
+			kept++;
+		}
+	}
 
-	// copy second part reverse to simpify merge
-	int workingEnd = end + pivot - start + 1;
-	for (int i = pivot + 1; i <= end; i++) {
-		copyEdge(&working[(workingEnd - i) * EDGE_MEMBERS],
-				&edgeList[i * EDGE_MEMBERS]);
+	// group the edges by their first component
+	for (Integer i = 0; i < components; i++) {
+		counts[i + 1] += counts[i];
+	}
+	for (Integer i = 0; i < kept; i++) {
+		buffer[counts[edgeList[i].from]++] = edgeList[i];
 	}
 
-	int left = 0;
-	int right = end - start;
-	for (int k = start; k <= end; k++) {
-		if (working[right * EDGE_MEMBERS + 2]
-				< working[left * EDGE_MEMBERS + 2]) {
-			copyEdge(&edgeList[k * EDGE_MEMBERS],
-					&working[right * EDGE_MEMBERS]);
-			right--;
-		} else {
-			copyEdge(&edgeList[k * EDGE_MEMBERS],
-					&working[left * EDGE_MEMBERS]);
-			left++;
+	// remember where the edge to each second component is kept
+	Integer* positions = (Integer*) malloc((components > 0 ? components : 1)
+			* sizeof(Integer));
+	memset(positions, UNSET_ELEMENT, components * sizeof(Integer));
+	Integer contracted = 0;
+	Integer start = 0;
+	for (Integer i = 0; i < components; i++) {
+		Integer first = contracted;
+		for (Integer j = start; j < counts[i]; j++) {
+			ContractedEdge* edge = &buffer[j];
+			if (positions[edge->to] < first) {
+				positions[edge->to] = contracted;
+				edgeList[contracted] = *edge;
+				contracted++;
+			} else {
+				ContractedEdge* keptEdge = &edgeList[positions[edge->to]];
+				if (lighterEdge(&edge->edge, &keptEdge->edge)) {
+					*keptEdge = *edge;
+				}
+			}
 		}
+		start = counts[i];
 	}
 
 	// clean up
-	free(working);
+	free(counts);
+	free(positions);
 
-// old merge
-//	int length = end - start + 1;
-//	// make a temporary copy of the list for merging
-//	int* working = (int*) malloc(length * EDGE_MEMBERS * sizeof(int));
-//	memcpy(working, &edgeList[start * EDGE_MEMBERS],
-//			length * EDGE_MEMBERS * sizeof(int));
-//
-//	// merge the two parts together
-//	int merge1 = 0;
-//	int merge2 = pivot - start + 1;
-//	for (int i = 0; i < length; i++) {
-//		if (merge2 <= end - start) {
-//			if (merge1 <= pivot - start) {
-//				if (working[merge1 * EDGE_MEMBERS + 2]
-//						> working[merge2 * EDGE_MEMBERS + 2]) {
-//					copyEdge(&edgeList[(i + start) * EDGE_MEMBERS],
-//							&working[merge2 * EDGE_MEMBERS]);
-//					merge2++;
-//				} else {
-//					copyEdge(&edgeList[(i + start) * EDGE_MEMBERS],
-//							&working[merge1 * EDGE_MEMBERS]);
-//					merge1++;
-//				}
-//			} else {
-//				copyEdge(&edgeList[(i + start) * EDGE_MEMBERS],
-//						&working[merge2 * EDGE_MEMBERS]);
-//				merge2++;
-//			}
-//		} else {
-//			copyEdge(&edgeList[(i + start) * EDGE_MEMBERS],
-//					&working[merge1 * EDGE_MEMBERS]);
-//			merge1++;
-//		}
-//	}
-//
-//	// clean up
-//	free(working);
-}
-
-/*
- * sort the edge list using merge sort, start and end are inclusive
- */
-void mergeSort(int* edgeList, const int start, const int end) {
-	if (start != end) {
-		// recursively divide the list in two parts and sort them
-		int pivot = (start + end) / 2;
-		mergeSort(edgeList, start, pivot);
-		mergeSort(edgeList, pivot + 1, end);
-
-		merge(edgeList, start, end, pivot);
-	}
+	return contracted;
 }
 
 /*
- * find a MST of the graph using Boruvka's algorithm
+ * number of edges of a generated graph
  */
-void mstBoruvka(const WeightedGraph* graph, WeightedGraph* mst) {
-	int rank;
-	int size;
-	MPI_Comm_rank(MPI_COMM_WORLD, &rank);
-	MPI_Comm_size(MPI_COMM_WORLD, &size);
-	MPI_Status status;
-
-	bool parallel = size != 1;
-
-	// send number of edges and vertices
-	int edges;
-	int vertices;
-	if (rank == 0) {
-		edges = graph->edges;
-		vertices = graph->vertices;
-		MPI_Bcast(&edges, 1, MPI_INT, 0, MPI_COMM_WORLD);
-		MPI_Bcast(&vertices, 1, MPI_INT, 0, MPI_COMM_WORLD);
+Integer countGeneratedEdges(const int family, const int rows,
+		const int columns, const int edges) {
+	const Integer vertices = (Integer) rows * columns;
+	if (family == GRID_GRAPH) {
+		return vertices * 2 - rows - columns;
+	} else if (vertices < 2) {
+		// no edges without self loops
+		return 0;
+	} else if (edges == 0) {
+		// default to the density of a grid
+		return vertices * 2;
+	} else if (edges < vertices - 1) {
+		// the random tree is always included
+		return vertices - 1;
 	} else {
-		MPI_Bcast(&edges, 1, MPI_INT, 0, MPI_COMM_WORLD);
-		MPI_Bcast(&vertices, 1, MPI_INT, 0, MPI_COMM_WORLD);
+		return edges;
 	}
+}
 
-	// scatter the edges to search in them
-	int edgesPart = (edges + size - 1) / size;
-	int* edgeListPart = (int*) malloc(edgesPart * EDGE_MEMBERS * sizeof(int));
-	if (parallel) {
-		scatterEdgeList(graph->edgeList, edgeListPart, edges, &edgesPart);
-	} else {
-		edgeListPart = graph->edgeList;
+/*
+ * sort the edge list by weight with a stable counting sort, all weights have
+ * to be in [minimum, minimum + range)
+ */
+void countingSort(Edge* edgeList, const Integer elements,
+		const Weight minimum, const Integer range) {
+	// count the edges of each weight
+	Integer* positions = (Integer*) calloc(range + 1, sizeof(Integer));
+	for (Integer i = 0; i < elements; i++) {
+		positions[edgeList[i].weight - minimum + 1]++;
 	}
 
-	// create needed data structures
-	Set* set = &(Set ) { .elements = 0, .canonicalElements = NULL, .rank =
-			NULL };
-	newSet(set, vertices);
-
-	int edgesMST = 0;
-	int* closestEdge = (int*) malloc(vertices * EDGE_MEMBERS * sizeof(int));
-	int* closestEdgeRecieved;
-	if (parallel) {
-		closestEdgeRecieved = (int*) malloc(
-				vertices * EDGE_MEMBERS * sizeof(int));
+	// a weight starts behind all edges with a smaller weight
+	for (Integer i = 0; i < range; i++) {
+		positions[i + 1] += positions[i];
 	}
 
-	for (int i = 1; i < vertices && edgesMST < vertices - 1; i *= 2) {
-		// reset all closestEdge
-		for (int j = 0; j < vertices; j++) {
-			closestEdge[j * EDGE_MEMBERS + 2] = INT_MAX;
-		}
-
-		// find closestEdge
-		for (int j = 0; j < edgesPart; j++) {
-			int* currentEdge = &edgeListPart[j * EDGE_MEMBERS];
-			int canonicalElements[2] = { findSet(set, currentEdge[0]), findSet(
-					set, currentEdge[1]) };
-
-			// eventually update closestEdge
-			if (canonicalElements[0] != canonicalElements[1]) {
-				for (int k = 0; k < 2; k++) {
-					bool closestEdgeNotSet = closestEdge[canonicalElements[k]
-							* EDGE_MEMBERS + 2] == INT_MAX;
-					bool weightSmaller = currentEdge[2]
-							< closestEdge[canonicalElements[k] * EDGE_MEMBERS
-									+ 2];
-					if (closestEdgeNotSet || weightSmaller) {
-						copyEdge(
-								&closestEdge[canonicalElements[k] * EDGE_MEMBERS],
-								currentEdge);
-					}
-				}
-			}
-		}
-
-		if (parallel) {
-			int from;
-			int to;
-			for (int step = 1; step < size; step *= 2) {
-				if (rank % (2 * step) == 0) {
-					from = rank + step;
-					if (from < size) {
-						MPI_Recv(closestEdgeRecieved, vertices * EDGE_MEMBERS,
-						MPI_INT, from, 0, MPI_COMM_WORLD, &status);
-
-						// combine all closestEdge parts
-						for (int i = 0; i < vertices; i++) {
-							int currentVertex = i * EDGE_MEMBERS;
-							if (closestEdgeRecieved[currentVertex + 2]
-									< closestEdge[currentVertex + 2]) {
-								copyEdge(&closestEdge[currentVertex],
-										&closestEdgeRecieved[currentVertex]);
-							}
-						}
-					}
-				} else if (rank % step == 0) {
-					to = rank - step;
-					MPI_Send(closestEdge, vertices * EDGE_MEMBERS, MPI_INT, to,
-							0,
-							MPI_COMM_WORLD);
-				}
-			}
-			// publish all closestEdge parts
-			MPI_Bcast(closestEdge, vertices * EDGE_MEMBERS, MPI_INT, 0,
-			MPI_COMM_WORLD);
-		}
-
-		// add new edges to MST
-		for (int j = 0; j < vertices; j++) {
-			if (closestEdge[j * EDGE_MEMBERS + 2] != INT_MAX) {
-				int from = closestEdge[j * EDGE_MEMBERS];
-				int to = closestEdge[j * EDGE_MEMBERS + 1];
-
-				// prevent adding the same edge twice
-				if (findSet(set, from) != findSet(set, to)) {
-					if (rank == 0) {
-						copyEdge(&mst->edgeList[edgesMST * EDGE_MEMBERS],
-								&closestEdge[j * EDGE_MEMBERS]);
-					}
-					edgesMST++;
-					unionSet(set, from, to);
-				}
-			}
-		}
+	// move the edges to their position and copy them back
+	Edge* working = (Edge*) malloc((size_t) elements * sizeof(Edge));
+	for (Integer i = 0; i < elements; i++) {
+		working[positions[edgeList[i].weight - minimum]++] = edgeList[i];
 	}
+	memcpy(edgeList, working, (size_t) elements * sizeof(Edge));
 
 	// clean up
-	deleteSet(set);
-	free(closestEdge);
-	if (parallel) {
-		free(closestEdgeRecieved);
-		free(edgeListPart);
-	}
+	free(positions);
+	free(working);
 }
 
 /*
- * find a MST of the graph using Kruskal's algorithm
+ * count the lines with content between start and end
  */
-void mstKruskal(WeightedGraph* graph, WeightedGraph* mst) {
-	// create needed data structures
-	Set* set = &(Set ) { .elements = 0, .canonicalElements = NULL, .rank =
-			NULL };
-	newSet(set, graph->vertices);
-
-	int rank;
-	MPI_Comm_rank(MPI_COMM_WORLD, &rank);
-
-	// sort the edges of the graph
-	sort(graph);
-
-	if (rank == 0) {
-		// add edges to the MST
-		int currentEdge = 0;
-		for (int edgesMST = 0;
-				edgesMST < graph->vertices - 1 || currentEdge < graph->edges;) {
-			// check for loops if edge would be inserted
-			int canonicalElementFrom = findSet(set,
-					graph->edgeList[currentEdge * EDGE_MEMBERS]);
-			int canonicalElementTo = findSet(set,
-					graph->edgeList[currentEdge * EDGE_MEMBERS + 1]);
-			if (canonicalElementFrom != canonicalElementTo) {
-				// add edge to MST
-				copyEdge(&mst->edgeList[edgesMST * EDGE_MEMBERS],
-						&graph->edgeList[currentEdge * EDGE_MEMBERS]);
-				unionSet(set, canonicalElementFrom, canonicalElementTo);
-				edgesMST++;
-			}
-			currentEdge++;
+Integer countLines(const char* start, const char* end) {
+	Integer lines = 0;
+	bool content = false;
+	for (const char* position = start; position < end; position++) {
+		if (*position == '\n') {
+			lines += content;
+			content = false;
+		} else if (*position != ' ' && *position != '\t' && *position != '\r') {
+			content = true;
 		}
 	}
 
-	// clean up
-	deleteSet(set);
+	return lines + content;
 }
 
 /*
- * find a MST of the graph using Prim's algorithm with a binary heap
+ * add the size of a message to the bytes sent by this process, collectives
+ * count the send buffer of the process once
  */
-void mstPrimBinary(const WeightedGraph* graph, WeightedGraph* mst) {
-	int rank;
-	MPI_Comm_rank(MPI_COMM_WORLD, &rank);
+void countSentBytes(const long count, MPI_Datatype datatype) {
+	int typeSize;
+	MPI_Type_size(datatype, &typeSize);
+	profile.counters[BYTE_COUNTER] += (uint64_t) count * typeSize;
+}
 
-	if (rank == 0) {
-		// create needed data structures
-		AdjacencyList* list = &(AdjacencyList ) { .elements = 0, .lists = NULL };
-		newAdjacencyList(list, graph);
-		for (int i = 0; i < graph->edges; i++) {
-			pushAdjacencyList(list, graph->edgeList[i * EDGE_MEMBERS],
-					graph->edgeList[i * EDGE_MEMBERS + 1],
-					graph->edgeList[i * EDGE_MEMBERS + 2]);
-		}
+/*
+ * save a 2D (rows x columns) grid graph with random edge weights to a binary
+ * graph file, each process generates and writes a block of rows
+ */
+void createMazeFile(const int rows, const int columns,
+		const unsigned int seed, const char outputFileName[]) {
+	int rank;
+	int size;
+	MPI_Comm_rank(MPI_COMM_GRAPH, &rank);
+	MPI_Comm_size(MPI_COMM_GRAPH, &size);
 
-		BinaryMinHeap* heap = &(BinaryMinHeap ) { .alloced = 0, .size = 0,
-						.positions = NULL, .elements = NULL };
-		newBinaryMinHeap(heap);
-		heap->positions = (int*) realloc(heap->positions,
-				graph->vertices * sizeof(int));
-		for (int i = 0; i < graph->vertices; i++) {
-			pushBinaryMinHeap(heap, i, INT_MAX, INT_MAX);
+	// open the file
+	MPI_File outputFile;
+	if (MPI_File_open(MPI_COMM_GRAPH, outputFileName,
+	MPI_MODE_CREATE | MPI_MODE_WRONLY, MPI_INFO_NULL, &outputFile)
+			!= MPI_SUCCESS) {
+		if (rank == 0) {
+			fprintf(stderr, "Couldn't open output file, exiting!\n");
 		}
+		MPI_Finalize();
+		exit(EXIT_FAILURE);
+	}
 
-		int vertex;
-		int via;
-		int weight;
+	// header contains number of vertices and edges
+	const Integer vertices = (Integer) rows * columns;
+	const Integer edges = countGeneratedEdges(GRID_GRAPH, rows, columns, 0);
+	MPI_File_set_size(outputFile,
+			sizeof(GraphFileHeader) + (MPI_Offset) edges * sizeof(Edge));
+	bool failed = false;
+	if (rank == 0) {
+		GraphFileHeader header = { .memberSize = sizeof(Integer), .weightSize =
+				sizeof(Weight), .vertices = vertices, .edges = edges };
+		memcpy(header.magic, BINARY_MAGIC, sizeof(BINARY_MAGIC));
+		failed = MPI_File_write_at(outputFile, 0, &header,
+				sizeof(GraphFileHeader), MPI_BYTE, MPI_STATUS_IGNORE)
+				!= MPI_SUCCESS;
+	}
 
-		// start at first vertex
-		decreaseBinaryMinHeap(heap, 0, 0, 0);
-		popBinaryMinHeap(heap, &vertex, &via, &weight);
-		for (int i = 0; i < list->lists[vertex].size; i++) {
-			decreaseBinaryMinHeap(heap, list->lists[vertex].elements[i].vertex,
-					vertex, list->lists[vertex].elements[i].weight);
+	// each process generates and writes a contiguous range of edges in bands
+	Integer startEdge;
+	Integer edgesPart;
+	partitionRange(edges, rank, size, &startEdge, &edgesPart);
+	Edge* band = (Edge*) malloc(
+			(size_t) (edgesPart < MAZE_BAND_EDGES ? edgesPart : MAZE_BAND_EDGES)
+					* sizeof(Edge));
+	for (Integer bandStart = startEdge; bandStart < startEdge + edgesPart;
+			bandStart += MAZE_BAND_EDGES) {
+		Integer bandEdges = startEdge + edgesPart - bandStart;
+		if (bandEdges > MAZE_BAND_EDGES) {
+			bandEdges = MAZE_BAND_EDGES;
+		}
+#pragma omp parallel for schedule(static)
+		for (Integer i = 0; i < bandEdges; i++) {
+			generateEdge(&band[i], (long) bandStart + i,
+					GRID_GRAPH, rows, columns, seed);
 		}
 
-		for (int i = 0; heap->size > 0; i++) {
-			// add edge from heap to MST
-			popBinaryMinHeap(heap, &vertex, &via, &weight);
-			mst->edgeList[i * EDGE_MEMBERS] = vertex;
-			mst->edgeList[i * EDGE_MEMBERS + 1] = via;
-			mst->edgeList[i * EDGE_MEMBERS + 2] = weight;
+		MPI_Offset offset = sizeof(GraphFileHeader)
+				+ (MPI_Offset) bandStart * sizeof(Edge);
+		failed = failed
+				|| MPI_File_write_at(outputFile, offset, band, bandEdges,
+						MPI_GRAPH_EDGE, MPI_STATUS_IGNORE) != MPI_SUCCESS;
+	}
 
-			// update heap
-			for (int j = 0; j < list->lists[vertex].size; j++) {
-				decreaseBinaryMinHeap(heap,
-						list->lists[vertex].elements[j].vertex, vertex,
-						list->lists[vertex].elements[j].weight);
-			}
-		}
+	// clean up
+	free(band);
+	MPI_File_close(&outputFile);
 
-		// clean up
-		deleteAdjacencyList(list);
-		deleteBinaryMinHeap(heap);
+	bool anyFailed;
+	MPI_Allreduce(&failed, &anyFailed, 1, MPI_C_BOOL, MPI_LOR,
+	MPI_COMM_GRAPH);
+	if (anyFailed) {
+		if (rank == 0) {
+			fprintf(stderr,
+					"Something went wrong during writing of maze file, exiting!\n");
+		}
+		MPI_Finalize();
+		exit(EXIT_FAILURE);
 	}
 }
 
 /*
- * find a MST of the graph using Prim's algorithm with a fibonacci heap
+ * remove a tree edge from the link-cut tree
  */
-void mstPrimFibonacci(const WeightedGraph* graph, WeightedGraph* mst) {
-	int rank;
-	MPI_Comm_rank(MPI_COMM_WORLD, &rank);
+void cutDynamicMst(DynamicMst* mst, const Integer edge) {
+	Integer node = mst->vertices + edge;
+	for (int i = 0; i < 2; i++) {
+		// after the evert the tree path is the endpoint followed by the edge
+		evertDynamicMst(mst,
+				i == 0 ? mst->edgeList[edge].from : mst->edgeList[edge].to);
+		accessDynamicMst(mst, node);
+		mst->parents[mst->children[2 * node]] = UNSET_ELEMENT;
+		mst->children[2 * node] = UNSET_ELEMENT;
+		refreshDynamicMst(mst, node);
+	}
 
-	if (rank == 0) {
-		// create needed data structures
-		AdjacencyList* list = &(AdjacencyList ) { .elements = 0, .lists = NULL };
-		newAdjacencyList(list, graph);
-		for (int i = 0; i < graph->edges; i++) {
-			pushAdjacencyList(list, graph->edgeList[i * EDGE_MEMBERS],
-					graph->edgeList[i * EDGE_MEMBERS + 1],
-					graph->edgeList[i * EDGE_MEMBERS + 2]);
-		}
+	clearBit(mst->inTree, edge);
+	mst->weight -= mst->edgeList[edge].weight;
+}
 
-		FibonacciMinHeap* heap = &(FibonacciMinHeap ) { .size = 0, .minimum =
-				NULL, .positions = NULL };
-		newFibonacciMinHeap(heap);
-		heap->positions = (FibonacciHeapElement**) realloc(heap->positions,
-				graph->vertices * sizeof(FibonacciHeapElement*));
-		for (int i = 0; i < graph->vertices; i++) {
-			pushFibonacciMinHeap(heap, i, INT_MAX, INT_MAX);
+/*
+ * cut an element from a fibonacci heap
+ */
+void cutFibonacciMinHeap(FibonacciMinHeap* heap, const Integer element) {
+	FibonacciHeapElement* elements = heap->elements;
+	Integer parent = elements[element].parent;
+	if (parent != UNSET_ELEMENT) {
+		elements[parent].childrens--;
+	}
+	if (elements[element].right == element) {
+		// only one element in the child list
+		elements[parent].child = UNSET_ELEMENT;
+	} else {
+		elements[elements[element].right].left = elements[element].left;
+		elements[elements[element].left].right = elements[element].right;
+		if (elements[parent].child == element) {
+			// update parents child pointer
+			elements[parent].child = elements[element].right;
 		}
+	}
 
-		int vertex;
-		int via;
-		int weight;
-
-		// start at first vertex
-		decreaseFibonacciMinHeap(heap, 0, 0, 0);
+	// insert as new root element
+	insertFibonacciMinHeap(heap, element);
+	elements[element].parent = UNSET_ELEMENT;
 
-		popFibonacciMinHeap(heap, &vertex, &via, &weight);
-		for (int i = 0; i < list->lists[vertex].size; i++) {
-			decreaseFibonacciMinHeap(heap,
-					list->lists[vertex].elements[i].vertex, vertex,
-					list->lists[vertex].elements[i].weight);
+	if (elements[parent].parent != UNSET_ELEMENT) {
+		// not a root element
+		if (elements[parent].marked) {
+			// recursively cut marked parent
+			cutFibonacciMinHeap(heap, parent);
+			elements[parent].marked = false;
+		} else {
+			elements[parent].marked = true;
 		}
+	}
+}
 
-		for (int i = 0; heap->size > 0; i++) {
-			// add edge from heap to MST
-			popFibonacciMinHeap(heap, &vertex, &via, &weight);
-			mst->edgeList[i * EDGE_MEMBERS] = vertex;
-			mst->edgeList[i * EDGE_MEMBERS + 1] = via;
-			mst->edgeList[i * EDGE_MEMBERS + 2] = weight;
-
-			// update heap
-			for (int j = 0; j < list->lists[vertex].size; j++) {
-				decreaseFibonacciMinHeap(heap,
-						list->lists[vertex].elements[j].vertex, vertex,
-						list->lists[vertex].elements[j].weight);
-			}
-		}
+/*
+ * only decrease the weight to a given vertex, a vertex which isn't in the heap
+ * yet is pushed
+ */
+void decreaseBinaryMinHeap(BinaryMinHeap* heap, const Integer vertex,
+		const Integer via, const Integer weight) {
+#ifdef MST_PROFILE
+	profile.counters[DECREASE_COUNTER]++;
+#endif
+	if (heap->positions[vertex] == UNSET_ELEMENT) {
+		pushBinaryMinHeap(heap, vertex, via, weight);
+	} else if (heap->elements[heap->positions[vertex]].weight > weight) {
+		heap->elements[heap->positions[vertex]].via = via;
+		heap->elements[heap->positions[vertex]].weight = weight;
+		heapifyBinaryMinHeap(heap, heap->positions[vertex]);
+	}
+}
 
-		// clean up
-		deleteAdjacencyList(list);
-		deleteFibonacciMinHeap(heap);
+/*
+ * only decrease the weight to a given vertex, a vertex which isn't in the
+ * queue yet is pushed
+ */
+void decreaseBucketQueue(BucketQueue* queue, const Integer vertex,
+		const Integer via, const Integer weight) {
+#ifdef MST_PROFILE
+	profile.counters[DECREASE_COUNTER]++;
+#endif
+	if (queue->keys[vertex] == UNSET_ELEMENT) {
+		pushBucketQueue(queue, vertex, via, weight);
+	} else if (queue->keys[vertex] > weight - queue->minimum) {
+		// move the vertex to the bucket of its new weight
+		unlinkBucketQueue(queue, vertex);
+		linkBucketQueue(queue, vertex, weight - queue->minimum);
+		queue->vias[vertex] = via;
 	}
 }
 
 /*
- * create adjacency list
+ * only decrease the weight to a given vertex, a vertex which isn't in the heap
+ * yet is pushed
  */
-void newAdjacencyList(AdjacencyList* list, const WeightedGraph* graph) {
-	int startSize = 4;
-	list->elements = graph->vertices;
-	list->lists = (List*) malloc(list->elements * sizeof(List));
-	for (int i = 0; i < list->elements; i++) {
-		list->lists[i].alloced = startSize;
-		list->lists[i].size = 0;
-		list->lists[i].elements = (ListElement*) malloc(
-				startSize * sizeof(ListElement));
+void decreaseDaryMinHeap(DaryMinHeap* heap, const Integer vertex,
+		const Integer via, const Integer weight) {
+#ifdef MST_PROFILE
+	profile.counters[DECREASE_COUNTER]++;
+#endif
+	Integer position = heap->positions[vertex];
+	if (position == UNSET_ELEMENT) {
+		pushDaryMinHeap(heap, vertex, via, weight);
+	} else if (heap->keys[position] > weight) {
+		heap->keys[position] = weight;
+		heap->vias[position] = via;
+		heapifyDaryMinHeap(heap, position);
 	}
 }
 
 /*
- * create binary min heap
+ * only decrease the weight to a given vertex, a vertex which isn't in the heap
+ * yet is pushed
  */
-void newBinaryMinHeap(BinaryMinHeap* heap) {
-	int startSize = 4;
-	heap->alloced = startSize;
-	heap->size = 0;
-	heap->positions = (int*) malloc(sizeof(int));
-	heap->elements = (BinaryHeapElement*) malloc(
-			startSize * sizeof(BinaryHeapElement));
+void decreaseFibonacciMinHeap(FibonacciMinHeap* heap, const Integer vertex,
+		const Integer via, const Integer weight) {
+#ifdef MST_PROFILE
+	profile.counters[DECREASE_COUNTER]++;
+#endif
+	Integer element = heap->positions[vertex];
+	FibonacciHeapElement* elements = heap->elements;
+	if (element == UNSET_ELEMENT) {
+		pushFibonacciMinHeap(heap, vertex, via, weight);
+	} else if (elements[element].weight > weight) {
+		elements[element].via = via;
+		elements[element].weight = weight;
+		if (elements[element].parent == UNSET_ELEMENT) {
+			if (elements[element].weight < elements[heap->minimum].weight) {
+				heap->minimum = element;
+			}
+		} else if (weight < elements[elements[element].parent].weight) {
+			// if heap property is violated cut off the element
+			cutFibonacciMinHeap(heap, element);
+		}
+	}
 }
 
 /*
- * create fibonacci min heap element
+ * cleanup adjacency list data
  */
-void newFibonacciHeapElement(FibonacciHeapElement* element, const int vertex,
-		const int via, const int weight, FibonacciHeapElement* left,
-		FibonacciHeapElement* right, FibonacciHeapElement* parent,
-		FibonacciHeapElement* child) {
-	element->childrens = 0;
-	element->marked = false;
-	element->vertex = vertex;
-	element->via = via;
-	element->weight = weight;
-	element->parent = parent;
-	element->child = child;
-	element->left = left;
-	element->right = right;
+void deleteAdjacencyList(AdjacencyList* list) {
+	free(list->offsets);
+	free(list->neighbors);
 }
 
 /*
- * create fibonacci min heap
+ * cleanup binary heap data
  */
-void newFibonacciMinHeap(FibonacciMinHeap* heap) {
-	heap->size = 0;
-	heap->positions = (FibonacciHeapElement**) malloc(
-			sizeof(FibonacciHeapElement*));
+void deleteBinaryMinHeap(BinaryMinHeap* heap) {
+	free(heap->elements);
+	free(heap->positions);
 }
 
 /*
- * initialize and allocate memory for the members of the graph
+ * free bucket queue
  */
-void newSet(Set* set, const int elements) {
-	set->elements = elements;
-	set->canonicalElements = (int*) malloc(elements * sizeof(int));
-	memset(set->canonicalElements, UNSET_ELEMENT, elements * sizeof(int));
-	set->rank = (int*) calloc(elements, sizeof(int));
+void deleteBucketQueue(BucketQueue* queue) {
+	free(queue->buckets);
+	free(queue->next);
+	free(queue->previous);
+	free(queue->keys);
+	free(queue->vias);
 }
 
 /*
- * initialize and allocate memory for the members of the graph
+ * free d-ary min heap
  */
-void newWeightedGraph(WeightedGraph* graph, const int vertices, const int edges) {
-	graph->edges = edges;
-	graph->vertices = vertices;
-	graph->edgeList = (int*) calloc(edges * EDGE_MEMBERS, sizeof(int));
+void deleteDaryMinHeap(DaryMinHeap* heap) {
+	free(heap->keys - (heap->arity - 1));
+	free(heap->vertices);
+	free(heap->vias);
+	free(heap->positions);
 }
 
 /*
- * remove the minimum of the heap
+ * free dynamic MST
  */
-void popBinaryMinHeap(BinaryMinHeap* heap, int* vertex, int* via, int* weight) {
-	*vertex = heap->elements[0].vertex;
-	*via = heap->elements[0].via;
-	*weight = heap->elements[0].weight;
-	heap->positions[heap->elements[0].vertex] = UNSET_ELEMENT;
-	heap->elements[0] = heap->elements[heap->size - 1];
-	heap->positions[heap->elements[0].vertex] = 0;
-	heap->size--;
-	heapifyDownBinaryMinHeap(heap, 0);
+void deleteDynamicMst(DynamicMst* mst) {
+	free(mst->edgeList);
+	free(mst->inTree);
+	free(mst->touched);
+	free(mst->heads);
+	free(mst->next);
+	free(mst->previous);
+	free(mst->children);
+	free(mst->parents);
+	free(mst->heaviest);
+	free(mst->flipped);
+	free(mst->stack);
+	free(mst->labels);
+	free(mst->queue);
+	free(mst->changeList);
 }
 
 /*
- * remove the minimum of the heap
+ * cleanup fibonacci heap data
  */
-void popFibonacciMinHeap(FibonacciMinHeap* heap, int* vertex, int* via,
-		int* weight) {
-	FibonacciHeapElement* minimum = heap->minimum;
-	if (minimum != NULL) {
-		// store the minimum
-		*vertex = minimum->vertex;
-		*via = minimum->via;
-		*weight = minimum->weight;
+void deleteFibonacciMinHeap(FibonacciMinHeap* heap) {
+	free(heap->degree);
+	free(heap->positions);
+	free(heap->elements);
+}
 
-		// add all childs of minimum to the parent list
-		for (int i = 0; i < minimum->childrens; i++) {
-			FibonacciHeapElement* child = minimum->child;
-			if (child == child->right) {
-				minimum->child = NULL;
+/*
+ * free the set and heaps kept between the runs
+ */
+void deleteScratch(Scratch* scratch) {
+	deleteSet(&scratch->set);
+	deleteBinaryMinHeap(&scratch->binaryHeap);
+	deleteFibonacciMinHeap(&scratch->fibonacciHeap);
+}
+
+/*
+ * cleanup set data
+ */
+void deleteSet(Set* set) {
+	free(set->parents);
+}
+
+/*
+ * cleanup graph data
+ */
+void deleteWeightedGraph(WeightedGraph* graph) {
+	if (graph->mapping != NULL) {
+		munmap(graph->mapping, graph->mappingSize);
+		graph->mapping = NULL;
+		graph->mappingSize = 0;
+	} else {
+		free(graph->edgeList);
+	}
+	graph->edgeList = NULL;
+}
+
+/*
+ * split the edge list of the first process evenly between all processes, the
+ * graph becomes partitioned
+ */
+void distributeEdgeList(WeightedGraph* graph) {
+	int rank;
+	int size;
+	MPI_Comm_rank(MPI_COMM_GRAPH, &rank);
+	MPI_Comm_size(MPI_COMM_GRAPH, &size);
+
+	if (graph->partitioned) {
+		return;
+	}
+	double lap = MPI_Wtime();
+
+	// send number of vertices and edges
+	Integer counts[2] = { graph->vertices, graph->edges };
+	MPI_Bcast(counts, 2, MPI_GRAPH_INTEGER, 0, MPI_COMM_GRAPH);
+	if (rank == 0) {
+		countSentBytes(2, MPI_GRAPH_INTEGER);
+	}
+
+	// whole edges are sent, so the counts and offsets are numbers of edges
+	int* sendCounts = (int*) malloc(size * sizeof(int));
+	int* offsets = (int*) malloc(size * sizeof(int));
+	for (int i = 0; i < size; i++) {
+		Integer start;
+		Integer edgesPart;
+		partitionRange(counts[1], i, size, &start, &edgesPart);
+		offsets[i] = start;
+		sendCounts[i] = edgesPart;
+	}
+
+	WeightedGraph part;
+	newWeightedGraph(&part, counts[0], sendCounts[rank]);
+	MPI_Scatterv(graph->edgeList, sendCounts, offsets, MPI_GRAPH_EDGE,
+			part.edgeList, sendCounts[rank], MPI_GRAPH_EDGE, 0, MPI_COMM_GRAPH);
+	if (rank == 0) {
+		countSentBytes(sumCounts(sendCounts, size), MPI_GRAPH_EDGE);
+	}
+	part.partitioned = true;
+
+	// clean up
+	deleteWeightedGraph(graph);
+	*graph = part;
+	free(sendCounts);
+	free(offsets);
+	lapPhase(SCATTER_PHASE, &lap);
+}
+
+/*
+ * make the node the root of its link-cut tree by reversing the path to the
+ * old root
+ */
+void evertDynamicMst(DynamicMst* mst, const Integer node) {
+	accessDynamicMst(mst, node);
+	mst->flipped[node] = !mst->flipped[node];
+}
+
+/*
+ * combine and publish the closestEdge parts of all processes, only the
+ * updated components are sent to the process owning them, which publishes
+ * the lightest edge of every component it owns
+ */
+void exchangeClosestEdge(Edge* closestEdge, const Integer components,
+		const Integer* updated, const Integer updatedCount) {
+	int rank;
+	int size;
+	MPI_Comm_rank(MPI_COMM_GRAPH, &rank);
+	MPI_Comm_size(MPI_COMM_GRAPH, &size);
+	double lap = MPI_Wtime();
+
+	// a component followed by its closest edge
+	MPI_Datatype MPI_COMPONENT_EDGE = newRecordType(1,
+			offsetof(ComponentEdge, edge), MPI_GRAPH_EDGE,
+			sizeof(ComponentEdge));
+
+	// group the updated components by their owner, the owners are cyclic
+	int* sendCounts = (int*) calloc(size, sizeof(int));
+	int* sendOffsets = (int*) malloc(size * sizeof(int));
+	int* recieveCounts = (int*) malloc(size * sizeof(int));
+	int* recieveOffsets = (int*) malloc(size * sizeof(int));
+	for (Integer i = 0; i < updatedCount; i++) {
+		sendCounts[updated[i] % size]++;
+	}
+	sendOffsets[0] = 0;
+	for (int i = 1; i < size; i++) {
+		sendOffsets[i] = sendOffsets[i - 1] + sendCounts[i - 1];
+	}
+	ComponentEdge* sendBuffer = (ComponentEdge*) malloc(
+			(updatedCount > 0 ? updatedCount : 1) * sizeof(ComponentEdge));
+	int* positions = (int*) malloc(size * sizeof(int));
+	memcpy(positions, sendOffsets, size * sizeof(int));
+	for (Integer i = 0; i < updatedCount; i++) {
+		sendBuffer[positions[updated[i] % size]++] = (ComponentEdge ) {
+						.component = updated[i], .edge =
+						closestEdge[updated[i]] };
+	}
+
+	// send the updated components to their owners
+	MPI_Alltoall(sendCounts, 1, MPI_INT, recieveCounts, 1, MPI_INT,
+			MPI_COMM_GRAPH);
+	countSentBytes(size, MPI_INT);
+	recieveOffsets[0] = 0;
+	for (int i = 1; i < size; i++) {
+		recieveOffsets[i] = recieveOffsets[i - 1] + recieveCounts[i - 1];
+	}
+	int recieved = recieveOffsets[size - 1] + recieveCounts[size - 1];
+	ComponentEdge* recieveBuffer = (ComponentEdge*) malloc(
+			(recieved > 0 ? recieved : 1) * sizeof(ComponentEdge));
+	MPI_Alltoallv(sendBuffer, sendCounts, sendOffsets, MPI_COMPONENT_EDGE,
+			recieveBuffer, recieveCounts, recieveOffsets, MPI_COMPONENT_EDGE,
+			MPI_COMM_GRAPH);
+	countSentBytes(sumCounts(sendCounts, size), MPI_COMPONENT_EDGE);
+
+	// combine the parts of the owned components
+	for (Integer i = rank; i < components; i += size) {
+		closestEdge[i].from = UNSET_ELEMENT;
+	}
+	for (Integer i = 0; i < recieved; i++) {
+		Edge* closest = &closestEdge[recieveBuffer[i].component];
+		if (lighterEdge(&recieveBuffer[i].edge, closest)) {
+			*closest = recieveBuffer[i].edge;
+		}
+	}
+	lapPhase(REDUCE_PHASE, &lap);
+
+	// collect the owned components which have an edge
+	int published = 0;
+	free(sendBuffer);
+	sendBuffer = (ComponentEdge*) malloc(
+			((components + size - 1) / size + 1) * sizeof(ComponentEdge));
+	for (Integer i = rank; i < components; i += size) {
+		if (closestEdge[i].from != UNSET_ELEMENT) {
+			sendBuffer[published++] = (ComponentEdge ) { .component = i, .edge =
+							closestEdge[i] };
+		}
+	}
+
+	// publish them to all processes
+	MPI_Allgather(&published, 1, MPI_INT, recieveCounts, 1, MPI_INT,
+			MPI_COMM_GRAPH);
+	countSentBytes(1, MPI_INT);
+	recieveOffsets[0] = 0;
+	for (int i = 1; i < size; i++) {
+		recieveOffsets[i] = recieveOffsets[i - 1] + recieveCounts[i - 1];
+	}
+	recieved = recieveOffsets[size - 1] + recieveCounts[size - 1];
+	free(recieveBuffer);
+	recieveBuffer = (ComponentEdge*) malloc((recieved > 0 ? recieved : 1)
+			* sizeof(ComponentEdge));
+	MPI_Allgatherv(sendBuffer, published, MPI_COMPONENT_EDGE, recieveBuffer,
+			recieveCounts, recieveOffsets, MPI_COMPONENT_EDGE, MPI_COMM_GRAPH);
+	countSentBytes(published, MPI_COMPONENT_EDGE);
+
+	for (Integer i = 0; i < components; i++) {
+		closestEdge[i].from = UNSET_ELEMENT;
+	}
+	for (Integer i = 0; i < recieved; i++) {
+		closestEdge[recieveBuffer[i].component] = recieveBuffer[i].edge;
+	}
+	lapPhase(BROADCAST_PHASE, &lap);
+
+	// clean up
+	free(sendCounts);
+	free(sendOffsets);
+	free(recieveCounts);
+	free(recieveOffsets);
+	free(sendBuffer);
+	free(recieveBuffer);
+	free(positions);
+	MPI_Type_free(&MPI_COMPONENT_EDGE);
+}
+
+/*
+ * mark the edges of a grid graph in a bitmap, bit 2 * vertex stands for the
+ * edge to the right neighbor and bit 2 * vertex + 1 for the edge to the
+ * neighbor below, edges between other vertices are ignored
+ */
+void fillMazeBitmap(uint64_t* bitmap, const WeightedGraph* graph,
+		const int rows, const int columns) {
+	Integer vertices = (Integer) rows * columns;
+	for (Integer i = 0; i < graph->edges; i++) {
+		Integer from = graph->edgeList[i].from;
+		Integer to = graph->edgeList[i].to;
+		if (from > to) {
+			Integer vertex = from;
+			from = to;
+			to = vertex;
+		}
+		if (from < 0 || to >= vertices) {
+			continue;
+		}
+
+		if (to == from + 1 && to % columns != 0) {
+			setBit(bitmap, 2 * from);
+		} else if (to == from + columns) {
+			setBit(bitmap, 2 * from + 1);
+		}
+	}
+}
+
+/*
+ * add the MST edges of an unsorted edge list, partition around a pivot weight
+ * and only keep heavy edges which connect different components after the
+ * light edges were added
+ */
+void filterKruskal(Edge* edgeList, const Integer edges, Set* set,
+		WeightedGraph* mst, Integer* edgesMST) {
+	if (*edgesMST == mst->vertices - 1) {
+		// MST is already complete
+		return;
+	} else if (edges <= FILTER_KRUSKAL_THRESHOLD) {
+		// small lists are sorted directly
+		sortEdgeList(edgeList, edges);
+		addSortedEdges(edgeList, edges, set, mst, edgesMST);
+		return;
+	}
+
+	// median of a few samples as pivot weight
+	const int samples = 9;
+	Weight sampleWeights[samples];
+	for (int i = 0; i < samples; i++) {
+		Integer position = randomNumber(edges, i) % edges;
+		Weight weight = edgeList[position].weight;
+		Integer j = i;
+		for (; j > 0 && sampleWeights[j - 1] > weight; j--) {
+			sampleWeights[j] = sampleWeights[j - 1];
+		}
+		sampleWeights[j] = weight;
+	}
+	Weight pivot = sampleWeights[samples / 2];
+
+	// three way partition: lighter, equal and heavier than the pivot
+	Integer light = 0;
+	Integer heavy = edges;
+	for (Integer i = 0; i < heavy;) {
+		Weight weight = edgeList[i].weight;
+		if (weight < pivot) {
+			swapEdge(&edgeList[i], &edgeList[light]);
+			light++;
+			i++;
+		} else if (weight > pivot) {
+			heavy--;
+			swapEdge(&edgeList[i], &edgeList[heavy]);
+		} else {
+			i++;
+		}
+	}
+
+	// light edges first, equal edges are already sorted
+	filterKruskal(edgeList, light, set, mst, edgesMST);
+	addSortedEdges(&edgeList[light], heavy - light, set, mst, edgesMST);
+	if (*edgesMST == mst->vertices - 1) {
+		return;
+	}
+
+	// filter heavy edges within one component, they are swapped behind the
+	// kept ones so the graph keeps all its edges
+	Integer kept = heavy;
+	for (Integer i = heavy; i < edges; i++) {
+		if (findSet(set, edgeList[i].from) != findSet(set, edgeList[i].to)) {
+			swapEdge(&edgeList[kept], &edgeList[i]);
+			kept++;
+		}
+	}
+	filterKruskal(&edgeList[heavy], kept - heavy, set, mst, edgesMST);
+}
+
+/*
+ * find an edge between two vertices in the list of the first one, returns
+ * UNSET_ELEMENT if there is none
+ */
+Integer findDynamicEdge(const DynamicMst* mst, const Integer from,
+		const Integer to) {
+	for (Integer i = mst->heads[from]; i != UNSET_ELEMENT; i = mst->next[i]) {
+		if (neighborDynamicMst(mst, i) == to) {
+			return i / 2;
+		}
+	}
+
+	return UNSET_ELEMENT;
+}
+
+/*
+ * return the root of the link-cut tree of the node
+ */
+Integer findRootDynamicMst(DynamicMst* mst, const Integer node) {
+	accessDynamicMst(mst, node);
+	Integer root = node;
+	pushDynamicMst(mst, root);
+	while (mst->children[2 * root] != UNSET_ELEMENT) {
+		root = mst->children[2 * root];
+		pushDynamicMst(mst, root);
+	}
+	splayDynamicMst(mst, root);
+
+	return root;
+}
+
+/*
+ * return the canonical element of a vertex, every visited element is linked
+ * to its grandparent on the way (path halving)
+ */
+Integer findSet(const Set* set, const Integer vertex) {
+	Integer* parents = set->parents;
+	Integer element = vertex;
+#ifdef MST_PROFILE
+	profile.counters[FIND_COUNTER]++;
+#endif
+	while (parents[element] >= 0) {
+		if (parents[parents[element]] >= 0) {
+			parents[element] = parents[parents[element]];
+#ifdef MST_PROFILE
+			profile.counters[COMPRESSION_COUNTER]++;
+#endif
+		}
+		element = parents[element];
+	}
+	return element;
+}
+
+/*
+ * print the MST edges the batch removed ("-") and added ("+"), an edge whose
+ * weight changed is both, frees the deleted edges, returns the number of
+ * printed edges
+ */
+Integer finishBatchDynamicMst(DynamicMst* mst) {
+	Integer printed = 0;
+	for (Integer i = 0; i < mst->changes; i++) {
+		EdgeChange* change = &mst->changeList[i];
+		Edge* edge = &mst->edgeList[change->edge];
+		bool exists = edge->from != UNSET_ELEMENT;
+		bool inTree = exists && getBit(mst->inTree, change->edge);
+		bool same = change->inTree && inTree && edge->weight == change->weight;
+		if (change->inTree && !same) {
+			printf("-\t%" INTEGER_FORMAT "\t%" INTEGER_FORMAT "\t%"
+					WEIGHT_FORMAT "\n", change->from, change->to,
+					change->weight);
+			printed++;
+		}
+		if (inTree && !same) {
+			printf("+\t%" INTEGER_FORMAT "\t%" INTEGER_FORMAT "\t%"
+					WEIGHT_FORMAT "\n", edge->from, edge->to, edge->weight);
+			printed++;
+		}
+
+		clearBit(mst->touched, change->edge);
+		if (!exists) {
+			// the free edges are linked by their first incidence
+			mst->next[2 * change->edge] = mst->freeEdge;
+			mst->freeEdge = change->edge;
+		}
+	}
+	mst->changes = 0;
+
+	return printed;
+}
+
+/*
+ * write the decimal digits of a value to the buffer, returns their number
+ */
+int formatInteger(char* buffer, const Integer value) {
+	// the magnitude of the smallest value doesn't fit into Integer
+	unsigned long long magnitude = value < 0 ?
+			0ULL - (unsigned long long) value : (unsigned long long) value;
+	char digits[20];
+	int length = 0;
+	do {
+		digits[length++] = '0' + magnitude % 10;
+		magnitude /= 10;
+	} while (magnitude > 0);
+
+	int written = 0;
+	if (value < 0) {
+		buffer[written++] = '-';
+	}
+	while (length > 0) {
+		buffer[written++] = digits[--length];
+	}
+
+	return written;
+}
+
+/*
+ * collect the parts of a partitioned graph in process order on the first
+ * process
+ */
+void gatherEdgeList(WeightedGraph* graph) {
+	int rank;
+	int size;
+	MPI_Comm_rank(MPI_COMM_GRAPH, &rank);
+	MPI_Comm_size(MPI_COMM_GRAPH, &size);
+
+	if (!graph->partitioned) {
+		return;
+	}
+	double lap = MPI_Wtime();
+
+	// whole edges are sent, so the counts and offsets are numbers of edges
+	int edgesPart = graph->edges;
+	int* recieveCounts = (int*) malloc(size * sizeof(int));
+	int* offsets = (int*) malloc(size * sizeof(int));
+	MPI_Gather(&edgesPart, 1, MPI_INT, recieveCounts, 1, MPI_INT, 0,
+			MPI_COMM_GRAPH);
+	countSentBytes(1, MPI_INT);
+	Integer edges = 0;
+	if (rank == 0) {
+		for (int i = 0; i < size; i++) {
+			offsets[i] = edges;
+			edges += recieveCounts[i];
+		}
+	}
+
+	WeightedGraph complete;
+	newWeightedGraph(&complete, graph->vertices, edges);
+	MPI_Gatherv(graph->edgeList, edgesPart, MPI_GRAPH_EDGE, complete.edgeList,
+			recieveCounts, offsets, MPI_GRAPH_EDGE, 0, MPI_COMM_GRAPH);
+	countSentBytes(edgesPart, MPI_GRAPH_EDGE);
+
+	// clean up
+	deleteWeightedGraph(graph);
+	*graph = complete;
+	free(recieveCounts);
+	free(offsets);
+	lapPhase(MERGE_PHASE, &lap);
+}
+
+/*
+ * generate the edge with the given index of a graph family, the edge only
+ * depends on the seed and the index
+ */
+void generateEdge(Edge* edge, const long index, const int family,
+		const int rows, const int columns, const unsigned int seed) {
+	const Integer vertices = (Integer) rows * columns;
+	if (family == GRID_GRAPH) {
+		// rows are ordered by vertex, each vertex has an edge to the right
+		// (except the last column) followed by an edge downwards (except the
+		// last row), so each full row has 2 * columns - 1 edges
+		Integer row = index / (2 * columns - 1);
+		Integer position = index % (2 * columns - 1);
+		Integer vertex = row * columns + position / 2;
+		bool down = row != rows - 1
+				&& (position % 2 == 1 || position == 2 * (columns - 1));
+		if (row == rows - 1) {
+			vertex = row * columns + position;
+		}
+		edge->from = vertex;
+		edge->to = down ? vertex + columns : vertex + 1;
+	} else if (index < vertices - 1) {
+		// the first edges form a random tree, so the graph is connected
+		edge->from = randomNumber(seed + 1, index) % (index + 1);
+		edge->to = index + 1;
+	} else if (family == RANDOM_GRAPH) {
+		// uniformly distributed endpoints without self loops
+		edge->from = randomNumber(seed + 1, index) % vertices;
+		edge->to = (edge->from + 1
+				+ randomNumber(seed + 2, index) % (vertices - 1)) % vertices;
+	} else {
+		// recursive matrix (R-MAT) with a power-law degree distribution,
+		// choose one quadrant of the adjacency matrix per level
+		int levels = ceil(log2(vertices));
+		long from = 0;
+		long to = 0;
+		for (Integer i = 0; i < levels; i++) {
+			double quadrant = (randomNumber(seed + 3, index * 64 + i) >> 11)
+					* (1.0 / 9007199254740992.0);
+			from = from * 2 + (quadrant >= 0.76);
+			to = to * 2 + (quadrant >= 0.57 && quadrant < 0.76)
+					+ (quadrant >= 0.95);
+		}
+		edge->from = from % vertices;
+		edge->to = to % vertices;
+		if (edge->from == edge->to) {
+			edge->to = (edge->to + 1) % vertices;
+		}
+	}
+	edge->weight = randomNumber(seed, index) % MAXIMUM_RANDOM;
+}
+
+/*
+ * generate a graph of a family in memory, either completely on the first
+ * process or partitioned so each process generates its part of the edges
+ */
+void generateGraph(WeightedGraph* graph, const int family, const int rows,
+		const int columns, const int edges, const unsigned int seed,
+		const bool partitioned) {
+	int rank;
+	int size;
+	MPI_Comm_rank(MPI_COMM_GRAPH, &rank);
+	MPI_Comm_size(MPI_COMM_GRAPH, &size);
+
+	if (family < GRID_GRAPH || family > RMAT_GRAPH) {
+		if (rank == 0) {
+			fprintf(stderr, "Unknown graph family: %d\n"
+					"-h for help\n", family);
+		}
+		MPI_Finalize();
+		exit(EXIT_FAILURE);
+	}
+
+	Integer start = 0;
+	Integer edgesPart = countGeneratedEdges(family, rows, columns, edges);
+	if (partitioned) {
+		partitionRange(edgesPart, rank, size, &start, &edgesPart);
+	} else if (rank != 0) {
+		return;
+	}
+
+	newWeightedGraph(graph, (Integer) rows * columns, edgesPart);
+	graph->partitioned = partitioned;
+#pragma omp parallel for schedule(static)
+	for (Integer i = 0; i < edgesPart; i++) {
+		generateEdge(&graph->edgeList[i], (long) start + i, family, rows,
+				columns, seed);
+	}
+}
+
+/*
+ * return a bit of a bit array
+ */
+bool getBit(const uint64_t* bits, const Integer position) {
+	return (bits[position / 64] >> (position % 64)) & 1;
+}
+
+/*
+ * double the number of edges of the dynamic MST, the edge nodes of the
+ * link-cut tree follow the vertices so they grow as well
+ */
+void growDynamicMst(DynamicMst* mst) {
+	mst->alloced *= 2;
+	size_t nodes = (size_t) mst->vertices + mst->alloced;
+	size_t words = ((size_t) mst->alloced + 63) / 64;
+	size_t oldWords = ((size_t) mst->alloced / 2 + 63) / 64;
+	mst->edgeList = (Edge*) realloc(mst->edgeList,
+			(size_t) mst->alloced * sizeof(Edge));
+	mst->inTree = (uint64_t*) realloc(mst->inTree, words * sizeof(uint64_t));
+	mst->touched = (uint64_t*) realloc(mst->touched, words * sizeof(uint64_t));
+	memset(&mst->inTree[oldWords], 0, (words - oldWords) * sizeof(uint64_t));
+	memset(&mst->touched[oldWords], 0, (words - oldWords) * sizeof(uint64_t));
+	mst->next = (Integer*) realloc(mst->next,
+			2 * (size_t) mst->alloced * sizeof(Integer));
+	mst->previous = (Integer*) realloc(mst->previous,
+			2 * (size_t) mst->alloced * sizeof(Integer));
+	mst->children = (Integer*) realloc(mst->children,
+			2 * nodes * sizeof(Integer));
+	mst->parents = (Integer*) realloc(mst->parents, nodes * sizeof(Integer));
+	mst->heaviest = (Integer*) realloc(mst->heaviest, nodes * sizeof(Integer));
+	mst->flipped = (bool*) realloc(mst->flipped, nodes * sizeof(bool));
+	mst->stack = (Integer*) realloc(mst->stack, nodes * sizeof(Integer));
+}
+
+/*
+ * check and restore heap property from given position upwards
+ */
+void heapifyBinaryMinHeap(BinaryMinHeap* heap, Integer position) {
+	while (position >= 0) {
+		Integer positionParent = (position - 1) / 2;
+		if (heap->elements[position].weight
+				< heap->elements[positionParent].weight) {
+			swapBinaryHeapElement(heap, position, positionParent);
+			position = positionParent;
+		} else {
+			break;
+		}
+	}
+}
+
+/*
+ * check and restore heap property from given position upwards
+ */
+void heapifyDaryMinHeap(DaryMinHeap* heap, Integer position) {
+	Integer key = heap->keys[position];
+	Integer vertex = heap->vertices[position];
+	Integer via = heap->vias[position];
+
+	// move larger parents down until the hole fits the element
+	while (position > 0) {
+		Integer positionParent = (position - 1) / heap->arity;
+		if (heap->keys[positionParent] <= key) {
+			break;
+		}
+		heap->keys[position] = heap->keys[positionParent];
+		heap->vertices[position] = heap->vertices[positionParent];
+		heap->vias[position] = heap->vias[positionParent];
+		heap->positions[heap->vertices[position]] = position;
+		position = positionParent;
+	}
+
+	heap->keys[position] = key;
+	heap->vertices[position] = vertex;
+	heap->vias[position] = via;
+	heap->positions[vertex] = position;
+}
+
+/*
+ * check and restore heap property from given position upwards
+ */
+void heapifyDownBinaryMinHeap(BinaryMinHeap* heap, Integer position) {
+	while (position < heap->size) {
+		Integer positionLeft = (position + 1) * 2 - 1;
+		Integer positionRight = (position + 1) * 2;
+		Integer positionSmallest = position;
+		if (positionLeft <= heap->size
+				&& heap->elements[positionLeft].weight
+						< heap->elements[positionSmallest].weight) {
+			positionSmallest = positionLeft;
+		}
+		if (positionRight <= heap->size
+				&& heap->elements[positionRight].weight
+						< heap->elements[positionSmallest].weight) {
+			positionSmallest = positionRight;
+		}
+		if (heap->elements[position].weight
+				> heap->elements[positionSmallest].weight) {
+			swapBinaryHeapElement(heap, position, positionSmallest);
+			position = positionSmallest;
+		} else {
+			break;
+		}
+	}
+}
+
+/*
+ * check and restore heap property from given position downwards
+ */
+void heapifyDownDaryMinHeap(DaryMinHeap* heap, Integer position) {
+	const Integer* keys = heap->keys;
+	Integer key = keys[position];
+	Integer vertex = heap->vertices[position];
+	Integer via = heap->vias[position];
+
+	while (true) {
+		Integer positionFirst = heap->arity * position + 1;
+		if (positionFirst >= heap->size) {
+			break;
+		}
+
+		// the children are contiguous keys of one cache line
+		Integer positionLast = positionFirst + heap->arity;
+		if (positionLast > heap->size) {
+			positionLast = heap->size;
+		}
+		Integer positionSmallest = positionFirst;
+		for (Integer i = positionFirst + 1; i < positionLast; i++) {
+			if (keys[i] < keys[positionSmallest]) {
+				positionSmallest = i;
+			}
+		}
+
+		if (keys[positionSmallest] >= key) {
+			break;
+		}
+		heap->keys[position] = keys[positionSmallest];
+		heap->vertices[position] = heap->vertices[positionSmallest];
+		heap->vias[position] = heap->vias[positionSmallest];
+		heap->positions[heap->vertices[position]] = position;
+		position = positionSmallest;
+	}
+
+	heap->keys[position] = key;
+	heap->vertices[position] = vertex;
+	heap->vias[position] = via;
+	heap->positions[vertex] = position;
+}
+
+/*
+ * add an edge which isn't in the tree if it connects two trees or replaces the
+ * heaviest edge of the cycle it closes
+ */
+void insertDynamicMst(DynamicMst* mst, const Integer edge) {
+	Integer from = mst->edgeList[edge].from;
+	Integer to = mst->edgeList[edge].to;
+	if (from == to) {
+		return;
+	}
+
+	evertDynamicMst(mst, from);
+	if (findRootDynamicMst(mst, to) == from) {
+		// the splay tree of to holds the tree path from from to to
+		accessDynamicMst(mst, to);
+		Integer heaviest = mst->heaviest[to] - mst->vertices;
+		if (mst->edgeList[heaviest].weight <= mst->edgeList[edge].weight) {
+			return;
+		}
+		logDynamicEdge(mst, heaviest);
+		cutDynamicMst(mst, heaviest);
+	}
+	linkDynamicMst(mst, edge);
+}
+
+/*
+ * merge element into fibonacci heap left to the minimum
+ */
+void insertFibonacciMinHeap(FibonacciMinHeap* heap, const Integer element) {
+	FibonacciHeapElement* elements = heap->elements;
+	if (heap->minimum == UNSET_ELEMENT) {
+		heap->minimum = element;
+	} else {
+		Integer endHeap = elements[heap->minimum].left;
+		elements[heap->minimum].left = element;
+		elements[element].left = endHeap;
+		elements[endHeap].right = element;
+		elements[element].right = heap->minimum;
+
+		// set new minimum
+		if (elements[heap->minimum].weight > elements[element].weight) {
+			heap->minimum = element;
+		}
+	}
+}
+
+/*
+ * true if a field of the maze (2 * rows - 1 x 2 * columns - 1 fields, the
+ * vertices at even rows and columns) is a vertex or an edge of the bitmap
+ */
+bool isMazePassage(const uint64_t* bitmap, const int columns, const long row,
+		const long column) {
+	if (row % 2 == 1 && column % 2 == 1) {
+		return false;
+	} else if (row % 2 == 0 && column % 2 == 0) {
+		return true;
+	}
+
+	return getBit(bitmap, 2 * ((row / 2) * columns + column / 2) + row % 2);
+}
+
+/*
+ * true if the node is the root of its splay tree, its parent if any is the
+ * path parent then
+ */
+bool isSplayRootDynamicMst(const DynamicMst* mst, const Integer node) {
+	Integer parent = mst->parents[node];
+	return parent == UNSET_ELEMENT || (mst->children[2 * parent] != node
+			&& mst->children[2 * parent + 1] != node);
+}
+
+/*
+ * add the time since the start of the lap to a phase, Boruvka's phases also
+ * to its current round, the next lap starts now
+ */
+void lapPhase(const Phase phase, double* lap) {
+	double now = MPI_Wtime();
+	profile.phases[phase] += now - *lap;
+	if (phase >= SCAN_PHASE && phase <= UNION_PHASE && profile.rounds > 0
+			&& profile.rounds <= PROFILE_ROUNDS) {
+		profile.roundPhases[profile.rounds - 1][phase] += now - *lap;
+	}
+	*lap = now;
+}
+
+/*
+ * compare two edges by weight, then by their endpoints, so that all processes
+ * agree on the lightest of equal weights, unset edges are the heaviest
+ */
+bool lighterEdge(const Edge* edge1, const Edge* edge2) {
+	if (edge1->from == UNSET_ELEMENT || edge2->from == UNSET_ELEMENT) {
+		return edge2->from == UNSET_ELEMENT && edge1->from != UNSET_ELEMENT;
+	} else if (edge1->weight != edge2->weight) {
+		return edge1->weight < edge2->weight;
+	} else if (edge1->from != edge2->from) {
+		return edge1->from < edge2->from;
+	} else {
+		return edge1->to < edge2->to;
+	}
+}
+
+/*
+ * insert a vertex at the front of a bucket
+ */
+void linkBucketQueue(BucketQueue* queue, const Integer vertex,
+		const Integer bucket) {
+	queue->keys[vertex] = bucket;
+	queue->previous[vertex] = UNSET_ELEMENT;
+	queue->next[vertex] = queue->buckets[bucket];
+	if (queue->buckets[bucket] != UNSET_ELEMENT) {
+		queue->previous[queue->buckets[bucket]] = vertex;
+	}
+	queue->buckets[bucket] = vertex;
+
+	// the keys of Prim's algorithm aren't monotone, so the scan may restart lower
+	if (bucket < queue->current) {
+		queue->current = bucket;
+	}
+}
+
+/*
+ * add an edge between two link-cut trees to the tree
+ */
+void linkDynamicMst(DynamicMst* mst, const Integer edge) {
+	Integer node = mst->vertices + edge;
+	for (int i = 0; i < 2; i++) {
+		// the everted endpoint hangs below the edge
+		Integer vertex =
+				i == 0 ? mst->edgeList[edge].from : mst->edgeList[edge].to;
+		evertDynamicMst(mst, vertex);
+		mst->parents[vertex] = node;
+	}
+
+	setBit(mst->inTree, edge);
+	mst->weight += mst->edgeList[edge].weight;
+}
+
+/*
+ * insert an incidence at the front of the list of its vertex
+ */
+void linkIncidence(DynamicMst* mst, const Integer incidence,
+		const Integer vertex) {
+	mst->previous[incidence] = UNSET_ELEMENT;
+	mst->next[incidence] = mst->heads[vertex];
+	if (mst->heads[vertex] != UNSET_ELEMENT) {
+		mst->previous[mst->heads[vertex]] = incidence;
+	}
+	mst->heads[vertex] = incidence;
+}
+
+/*
+ * read the graph file, binary files are read in parallel by all processes for
+ * the partitioned algorithms, all other files by the first process, returns
+ * false on all processes if the file can't be read
+ */
+bool loadGraphFile(WeightedGraph* graph, const char inputFileName[],
+		const bool partitioned) {
+	int rank;
+	MPI_Comm_rank(MPI_COMM_GRAPH, &rank);
+
+	bool binary = false;
+	bool read = true;
+	if (partitioned) {
+		read = readGraphFilePart(graph, inputFileName, &binary);
+	}
+	if (read && !binary) {
+		if (rank == 0) {
+			read = readGraphFile(graph, inputFileName);
+		}
+		MPI_Allreduce(MPI_IN_PLACE, &read, 1, MPI_C_BOOL, MPI_LAND,
+				MPI_COMM_GRAPH);
+	}
+	return read;
+}
+
+/*
+ * remember the state of an edge before the first change of the batch
+ */
+void logDynamicEdge(DynamicMst* mst, const Integer edge) {
+	if (getBit(mst->touched, edge)) {
+		return;
+	}
+	setBit(mst->touched, edge);
+
+	if (mst->changes == mst->changesAlloced) {
+		// double the size if the log is full
+		mst->changesAlloced *= 2;
+		mst->changeList = (EdgeChange*) realloc(mst->changeList,
+				mst->changesAlloced * sizeof(EdgeChange));
+	}
+	mst->changeList[mst->changes++] = (EdgeChange ) { .edge = edge, .inTree =
+					getBit(mst->inTree, edge), .from = mst->edgeList[edge].from,
+					.to = mst->edgeList[edge].to, .weight =
+					mst->edgeList[edge].weight };
+}
+
+/*
+ * look up the values of the given vertices, every process holds the values of
+ * its range of the vertices in ownedValues and answers the requests for them
+ */
+void lookupOwnedValues(const Integer* keys, Integer* values,
+		const Integer elements, const Integer* ownedValues,
+		const Integer vertices) {
+	int rank;
+	int size;
+	MPI_Comm_rank(MPI_COMM_GRAPH, &rank);
+	MPI_Comm_size(MPI_COMM_GRAPH, &size);
+	Integer start;
+	Integer owned;
+	partitionRange(vertices, rank, size, &start, &owned);
+
+	// group the requests by the owner of the vertex
+	int* sendCounts = (int*) calloc(size, sizeof(int));
+	int* sendOffsets = (int*) malloc(size * sizeof(int));
+	int* recieveCounts = (int*) malloc(size * sizeof(int));
+	int* recieveOffsets = (int*) malloc(size * sizeof(int));
+	int* order = (int*) malloc((elements > 0 ? elements : 1) * sizeof(int));
+	for (Integer i = 0; i < elements; i++) {
+		order[i] = partitionOwner(vertices, size, keys[i]);
+		sendCounts[order[i]]++;
+	}
+	sendOffsets[0] = 0;
+	for (int i = 1; i < size; i++) {
+		sendOffsets[i] = sendOffsets[i - 1] + sendCounts[i - 1];
+	}
+	int* positions = (int*) malloc(size * sizeof(int));
+	memcpy(positions, sendOffsets, size * sizeof(int));
+	Integer* sendBuffer = (Integer*) malloc((elements > 0 ? elements : 1)
+			* sizeof(Integer));
+	for (Integer i = 0; i < elements; i++) {
+		order[i] = positions[order[i]]++;
+		sendBuffer[order[i]] = keys[i];
+	}
+
+	// send the requests to the owners
+	MPI_Alltoall(sendCounts, 1, MPI_INT, recieveCounts, 1, MPI_INT,
+			MPI_COMM_GRAPH);
+	countSentBytes(size, MPI_INT);
+	recieveOffsets[0] = 0;
+	for (int i = 1; i < size; i++) {
+		recieveOffsets[i] = recieveOffsets[i - 1] + recieveCounts[i - 1];
+	}
+	int requests = recieveOffsets[size - 1] + recieveCounts[size - 1];
+	Integer* recieveBuffer = (Integer*) malloc(
+			(requests > 0 ? requests : 1) * sizeof(Integer));
+	MPI_Alltoallv(sendBuffer, sendCounts, sendOffsets, MPI_GRAPH_INTEGER,
+			recieveBuffer, recieveCounts, recieveOffsets, MPI_GRAPH_INTEGER,
+			MPI_COMM_GRAPH);
+	countSentBytes(elements, MPI_GRAPH_INTEGER);
+
+	// answer them in the same order
+	for (Integer i = 0; i < requests; i++) {
+		recieveBuffer[i] = ownedValues[recieveBuffer[i] - start];
+	}
+	MPI_Alltoallv(recieveBuffer, recieveCounts, recieveOffsets,
+			MPI_GRAPH_INTEGER, sendBuffer, sendCounts, sendOffsets,
+			MPI_GRAPH_INTEGER, MPI_COMM_GRAPH);
+	countSentBytes(requests, MPI_GRAPH_INTEGER);
+	for (Integer i = 0; i < elements; i++) {
+		values[i] = sendBuffer[order[i]];
+	}
+
+	// clean up
+	free(sendCounts);
+	free(sendOffsets);
+	free(recieveCounts);
+	free(recieveOffsets);
+	free(order);
+	free(positions);
+	free(sendBuffer);
+	free(recieveBuffer);
+}
+
+/*
+ * map a binary graph file into memory, the edge list points into the mapping,
+ * returns false if the file can't be read
+ */
+bool mapGraphFile(WeightedGraph* graph, const char inputFileName[]) {
+	// open the file
+	int inputFile = open(inputFileName, O_RDONLY);
+	if (inputFile == -1) {
+		fprintf(stderr, "Couldn't open input file!\n");
+		return false;
+	}
+
+	struct stat fileStatus;
+	if (fstat(inputFile, &fileStatus) == -1
+			|| fileStatus.st_size < (off_t) sizeof(GraphFileHeader)) {
+		fprintf(stderr, "Couldn't read binary graph file!\n");
+		close(inputFile);
+		return false;
+	}
+
+	// private writable mapping, so the edge list can be sorted in place
+	size_t mappingSize = fileStatus.st_size;
+	void* mapping = mmap(NULL, mappingSize, PROT_READ | PROT_WRITE,
+	MAP_PRIVATE, inputFile, 0);
+	close(inputFile);
+	if (mapping == MAP_FAILED) {
+		fprintf(stderr, "Couldn't map binary graph file!\n");
+		return false;
+	}
+
+	// header contains number of vertices and edges, the size of the edges
+	// must not overflow for huge edge counts
+	GraphFileHeader* header = (GraphFileHeader*) mapping;
+	size_t maximumEdges = (SIZE_MAX - sizeof(GraphFileHeader)) / sizeof(Edge);
+	if (memcmp(header->magic, BINARY_MAGIC, sizeof(BINARY_MAGIC)) != 0
+			|| header->memberSize != sizeof(Integer)
+			|| header->weightSize != sizeof(Weight) || header->vertices < 0
+			|| header->edges < 0 || (uint64_t) header->edges > maximumEdges
+			|| mappingSize < sizeof(GraphFileHeader)
+					+ (size_t) header->edges * sizeof(Edge)
+			|| !validEdges((Edge*) (header + 1), header->edges,
+					header->vertices)) {
+		fprintf(stderr, "Malformed binary graph file!\n");
+		munmap(mapping, mappingSize);
+		return false;
+	}
+	madvise(mapping, mappingSize, MADV_SEQUENTIAL);
+
+	// all bytes after the header are the edges "from to weight"
+	graph->edges = header->edges;
+	graph->vertices = header->vertices;
+	graph->edgeList = (Edge*) (header + 1);
+	graph->mapping = mapping;
+	graph->mappingSize = mappingSize;
+	return true;
+}
+
+/*
+ * replay the heap operations of Prim's algorithm and the union-find operations
+ * of Kruskal's algorithm on a grid and a random graph on every heap and the
+ * set, print a CSV line with the median time and cache misses per operation of
+ * the trials after a warm-up run for each structure
+ */
+void microbenchmark(const Handle* handle) {
+	const char* familyNames[] = { "grid", "random" };
+	const int families[] = { GRID_GRAPH, RANDOM_GRAPH };
+
+	int counter = openCacheMissCounter();
+	printf("workload,family,structure,operations,nsPerOperation,"
+			"cacheMissesPerOperation\n");
+	double* times = (double*) malloc(handle->trials * sizeof(double));
+	double* misses = (double*) malloc(handle->trials * sizeof(double));
+	for (int family = 0; family < 2; family++) {
+		WeightedGraph* graph = &(WeightedGraph ) { .partitioned = false,
+						.edges = 0, .vertices = 0, .edgeList = NULL,
+						.mappingSize = 0, .mapping = NULL };
+		generateGraph(graph, families[family], handle->rows, handle->columns,
+				handle->edges, handle->seed, false);
+
+		// the heaps replay the operations of Prim's algorithm
+		HeapOperation* heapTrace = (HeapOperation*) malloc(
+				2 * ((size_t) graph->vertices + graph->edges)
+						* sizeof(HeapOperation));
+		Integer operations = recordPrimTrace(graph, heapTrace);
+		for (int heap = BINARY_HEAP; heap <= BUCKET_QUEUE; heap++) {
+			bool replayed = true;
+			for (int trial = -1; trial < handle->trials && replayed; trial++) {
+				replayed = replayHeapTrace(heapTrace, operations,
+						graph->vertices, heap, handle->arity, counter,
+						&times[trial < 0 ? 0 : trial],
+						&misses[trial < 0 ? 0 : trial]);
+			}
+			if (replayed) {
+				printMicrobenchmark("prim", familyNames[family],
+						HEAP_NAMES[heap], operations, times, misses,
+						handle->trials);
+			}
+		}
+		free(heapTrace);
+
+		// the set replays the finds of Kruskal's algorithm
+		Integer* setTrace = (Integer*) malloc(
+				2 * (size_t) graph->edges * sizeof(Integer));
+		Integer checked = recordKruskalTrace(graph, setTrace);
+		for (int trial = -1; trial < handle->trials; trial++) {
+			replaySetTrace(setTrace, checked, graph->vertices, counter,
+					&times[trial < 0 ? 0 : trial],
+					&misses[trial < 0 ? 0 : trial]);
+		}
+		printMicrobenchmark("kruskal", familyNames[family], "unionFind",
+				2 * (long) checked, times, misses, handle->trials);
+		free(setTrace);
+
+		deleteWeightedGraph(graph);
+	}
+
+	// clean up
+	free(times);
+	free(misses);
+	if (counter >= 0) {
+		close(counter);
+	}
+}
+
+/*
+ * reduction operation which keeps the lighter edge of each pair
+ */
+void minimumEdge(void* in, void* inout, int* elements,
+		MPI_Datatype* datatype) {
+	// the operation is only used with MPI_GRAPH_EDGE
+	(void) datatype;
+
+	Edge* edgesIn = (Edge*) in;
+	Edge* edgesInOut = (Edge*) inout;
+	for (int i = 0; i < *elements; i++) {
+		if (lighterEdge(&edgesIn[i], &edgesInOut[i])) {
+			edgesInOut[i] = edgesIn[i];
+		}
+	}
+}
+
+/*
+ * find a MST of the graph using Boruvka's algorithm
+ */
+void mstBoruvka(WeightedGraph* graph, WeightedGraph* mst, Scratch* scratch) {
+	int rank;
+	int size;
+	MPI_Comm_rank(MPI_COMM_GRAPH, &rank);
+	MPI_Comm_size(MPI_COMM_GRAPH, &size);
+
+	bool parallel = size != 1;
+	MPI_Op MPI_MINIMUM_EDGE;
+	if (parallel) {
+		// every process searches its part of the edges
+		distributeEdgeList(graph);
+
+		// closestEdge parts are combined edge by edge
+		MPI_Op_create(minimumEdge, true, &MPI_MINIMUM_EDGE);
+	}
+	Integer vertices = graph->vertices;
+
+	// the components of the endpoints are stored in front of each edge, edges
+	// inside a component are dropped right away
+	Integer edges = 0;
+	ContractedEdge* edgeList = (ContractedEdge*) malloc(
+			(graph->edges > 0 ? graph->edges : 1) * sizeof(ContractedEdge));
+	ContractedEdge* buffer = (ContractedEdge*) malloc(
+			(graph->edges > 0 ? graph->edges : 1) * sizeof(ContractedEdge));
+	for (Integer i = 0; i < graph->edges; i++) {
+		Edge* edge = &graph->edgeList[i];
+		if (edge->from != edge->to) {
+			edgeList[edges++] = (ContractedEdge ) { .from = edge->from, .to =
+							edge->to, .edge = *edge };
+		}
+	}
+
+	// create needed data structures
+	Set* set = scratchSet(scratch, vertices);
+
+	Integer components = vertices;
+	Integer* roots = (Integer*) malloc((vertices > 0 ? vertices : 1)
+			* sizeof(Integer));
+	Integer* labels = (Integer*) malloc((vertices > 0 ? vertices : 1)
+			* sizeof(Integer));
+	Integer* mapping = (Integer*) malloc((vertices > 0 ? vertices : 1)
+			* sizeof(Integer));
+	for (Integer i = 0; i < vertices; i++) {
+		roots[i] = i;
+	}
+
+	Integer edgesMST = 0;
+	Edge* closestEdge = (Edge*) malloc(
+			(vertices > 0 ? vertices : 1) * sizeof(Edge));
+	Integer* updated = (Integer*) malloc((vertices > 0 ? vertices : 1)
+			* sizeof(Integer));
+	Integer* closestIndex = (Integer*) malloc(
+			(vertices > 0 ? vertices : 1) * sizeof(Integer));
+	Weight* closestWeight = (Weight*) malloc(
+			(vertices > 0 ? vertices : 1) * sizeof(Weight));
+
+	while (true) {
+		profile.rounds++;
+		double lap = MPI_Wtime();
+
+		// reset all closestEdge
+#pragma omp parallel for schedule(static)
+		for (Integer i = 0; i < components; i++) {
+			closestIndex[i] = UNSET_ELEMENT;
+			closestWeight[i] = WEIGHT_MAXIMUM;
+		}
+
+		// find closestEdge, the endpoints are always in different components,
+		// the threads first lower the weight of the closest edge of each
+		// component comparing weights only, then only the edges of that weight
+		// compete for the index of the closest edge
+#pragma omp parallel for schedule(static)
+		for (Integer i = 0; i < edges; i++) {
+			atomicMinimumWeight(&closestWeight[edgeList[i].from],
+					edgeList[i].edge.weight);
+			atomicMinimumWeight(&closestWeight[edgeList[i].to],
+					edgeList[i].edge.weight);
+		}
+#pragma omp parallel for schedule(static)
+		for (Integer i = 0; i < edges; i++) {
+			Weight weight = edgeList[i].edge.weight;
+			if (weight == closestWeight[edgeList[i].from]) {
+				atomicLighterEdge(&closestIndex[edgeList[i].from], i, edgeList);
+			}
+			if (weight == closestWeight[edgeList[i].to]) {
+				atomicLighterEdge(&closestIndex[edgeList[i].to], i, edgeList);
+			}
+		}
+#pragma omp parallel for schedule(static)
+		for (Integer i = 0; i < components; i++) {
+			if (closestIndex[i] == UNSET_ELEMENT) {
+				closestEdge[i].from = UNSET_ELEMENT;
+			} else {
+				closestEdge[i] = edgeList[closestIndex[i]].edge;
+			}
+		}
+		Integer updatedCount = 0;
+		for (Integer i = 0; i < components; i++) {
+			if (closestIndex[i] != UNSET_ELEMENT) {
+				updated[updatedCount++] = i;
+			}
+		}
+		lapPhase(SCAN_PHASE, &lap);
+
+		if (parallel) {
+			// only send the updated components once they are a small part of
+			// the remaining ones
+			Integer updatedMaximum;
+			MPI_Allreduce(&updatedCount, &updatedMaximum, 1, MPI_GRAPH_INTEGER,
+					MPI_MAX, MPI_COMM_GRAPH);
+			countSentBytes(1, MPI_GRAPH_INTEGER);
+			if (2 * updatedMaximum < components) {
+				// the exchange times its reduce and broadcast itself
+				lapPhase(REDUCE_PHASE, &lap);
+				exchangeClosestEdge(closestEdge, components, updated,
+						updatedCount);
+				lap = MPI_Wtime();
+			} else {
+				// combine and publish all closestEdge parts, only the remaining
+				// components are exchanged
+				MPI_Allreduce(MPI_IN_PLACE, closestEdge, components,
+						MPI_GRAPH_EDGE, MPI_MINIMUM_EDGE, MPI_COMM_GRAPH);
+				countSentBytes(components, MPI_GRAPH_EDGE);
+				lapPhase(REDUCE_PHASE, &lap);
+			}
+		}
+
+		// add new edges to MST
+		bool found = false;
+		for (Integer i = 0; i < components; i++) {
+			if (closestEdge[i].from != UNSET_ELEMENT) {
+				Integer from = closestEdge[i].from;
+				Integer to = closestEdge[i].to;
+				found = true;
+
+				// prevent adding the same edge twice
+				if (findSet(set, from) != findSet(set, to)) {
+					if (rank == 0) {
+						mst->edgeList[edgesMST] = closestEdge[i];
+					}
+					edgesMST++;
+					unionSet(set, from, to);
+				}
+			}
+		}
+
+		if (!found) {
+			// no component has an edge to another one
+			lapPhase(UNION_PHASE, &lap);
+			break;
+		}
+
+		// number the merged components and map the old ones to them
+		Integer contracted = 0;
+		for (Integer i = 0; i < components; i++) {
+			mapping[i] = findSet(set, roots[i]);
+		}
+		for (Integer i = 0; i < components; i++) {
+			if (mapping[i] == roots[i]) {
+				labels[roots[i]] = contracted;
+				roots[contracted++] = roots[i];
+			}
+		}
+		for (Integer i = 0; i < components; i++) {
+			mapping[i] = labels[mapping[i]];
+		}
+
+		edges = contractEdgeList(edgeList, buffer, edges, mapping, contracted);
+		components = contracted;
+		lapPhase(UNION_PHASE, &lap);
+	}
+
+	if (rank == 0) {
+		mst->edges = edgesMST;
+	}
+
+	// clean up
+	free(edgeList);
+	free(buffer);
+	free(roots);
+	free(labels);
+	free(mapping);
+	free(closestEdge);
+	free(updated);
+	free(closestIndex);
+	free(closestWeight);
+	if (parallel) {
+		MPI_Op_free(&MPI_MINIMUM_EDGE);
+	}
+}
+
+/*
+ * find a MST of the graph using Boruvka's algorithm where every process only
+ * holds the components of its range of the vertices, components are merged by
+ * hooking them onto their closest one and pointer jumping
+ */
+void mstBoruvkaDistributed(WeightedGraph* graph, WeightedGraph* mst) {
+	int rank;
+	int size;
+	MPI_Comm_rank(MPI_COMM_GRAPH, &rank);
+	MPI_Comm_size(MPI_COMM_GRAPH, &size);
+
+	if (size != 1) {
+		// every process searches its part of the edges
+		distributeEdgeList(graph);
+	}
+	Integer vertices = graph->vertices;
+	Integer start;
+	Integer owned;
+	partitionRange(vertices, rank, size, &start, &owned);
+
+	// the components of the endpoints are stored in front of each edge, edges
+	// inside a component are dropped right away
+	Integer edges = 0;
+	ContractedEdge* edgeList = (ContractedEdge*) malloc(
+			(graph->edges > 0 ? graph->edges : 1) * sizeof(ContractedEdge));
+	for (Integer i = 0; i < graph->edges; i++) {
+		Edge* edge = &graph->edgeList[i];
+		if (edge->from != edge->to) {
+			edgeList[edges++] = (ContractedEdge ) { .from = edge->from, .to =
+							edge->to, .edge = *edge };
+		}
+	}
+	edges = reduceContractedEdges(edgeList, edges);
+
+	// every owned vertex starts as its own component
+	Integer* parents = (Integer*) malloc((owned > 0 ? owned : 1)
+			* sizeof(Integer));
+	Integer* active = (Integer*) malloc((owned > 0 ? owned : 1)
+			* sizeof(Integer));
+	Integer activeCount = owned;
+	for (Integer i = 0; i < owned; i++) {
+		parents[i] = start + i;
+		active[i] = start + i;
+	}
+	Edge* closestEdge = (Edge*) malloc((owned > 0 ? owned : 1) * sizeof(Edge));
+	Integer* keys = (Integer*) malloc((owned > 0 ? owned : 1)
+			* sizeof(Integer));
+	Integer* values = (Integer*) malloc((owned > 0 ? owned : 1)
+			* sizeof(Integer));
+
+	// an owned component adds at most one edge before it stops being a root
+	Integer edgesMST = 0;
+	Edge* edgeListMST = (Edge*) malloc((owned > 0 ? owned : 1) * sizeof(Edge));
+
+	// a record is a contracted edge seen from its first component
+	MPI_Datatype MPI_CONTRACTED_EDGE = newRecordType(2,
+			offsetof(ContractedEdge, edge), MPI_GRAPH_EDGE,
+			sizeof(ContractedEdge));
+
+	int* sendCounts = (int*) malloc(size * sizeof(int));
+	int* sendOffsets = (int*) malloc(size * sizeof(int));
+	int* recieveCounts = (int*) malloc(size * sizeof(int));
+	int* recieveOffsets = (int*) malloc(size * sizeof(int));
+
+	while (true) {
+		profile.rounds++;
+		double lap = MPI_Wtime();
+
+		// find the lightest local edge of every component, each edge is seen
+		// from both of its components
+		Integer records = 2 * edges;
+		ContractedEdge* recordList = (ContractedEdge*) malloc(
+				(records > 0 ? records : 1) * sizeof(ContractedEdge));
+		for (Integer i = 0; i < edges; i++) {
+			ContractedEdge* edge = &edgeList[i];
+			recordList[2 * i] = *edge;
+			recordList[2 * i + 1] = (ContractedEdge ) { .from = edge->to, .to =
+							edge->from, .edge = edge->edge };
+		}
+		qsort(recordList, records, sizeof(ContractedEdge),
+				compareComponentEdges);
+		Integer closest = 0;
+		for (Integer i = 0; i < records; i++) {
+			if (closest == 0
+					|| recordList[i].from != recordList[closest - 1].from) {
+				recordList[closest++] = recordList[i];
+			}
+		}
+		lapPhase(SCAN_PHASE, &lap);
+
+		// send them to the owners of the components, the records are already
+		// grouped by owner
+		memset(sendCounts, 0, size * sizeof(int));
+		for (Integer i = 0; i < closest; i++) {
+			sendCounts[partitionOwner(vertices, size, recordList[i].from)]++;
+		}
+		sendOffsets[0] = 0;
+		for (int i = 1; i < size; i++) {
+			sendOffsets[i] = sendOffsets[i - 1] + sendCounts[i - 1];
+		}
+		MPI_Alltoall(sendCounts, 1, MPI_INT, recieveCounts, 1, MPI_INT,
+				MPI_COMM_GRAPH);
+		countSentBytes(size, MPI_INT);
+		recieveOffsets[0] = 0;
+		for (int i = 1; i < size; i++) {
+			recieveOffsets[i] = recieveOffsets[i - 1] + recieveCounts[i - 1];
+		}
+		int recieved = recieveOffsets[size - 1] + recieveCounts[size - 1];
+		ContractedEdge* recieveBuffer = (ContractedEdge*) malloc(
+				(recieved > 0 ? recieved : 1) * sizeof(ContractedEdge));
+		MPI_Alltoallv(recordList, sendCounts, sendOffsets, MPI_CONTRACTED_EDGE,
+				recieveBuffer, recieveCounts, recieveOffsets,
+				MPI_CONTRACTED_EDGE, MPI_COMM_GRAPH);
+		countSentBytes(sumCounts(sendCounts, size), MPI_CONTRACTED_EDGE);
+		free(recordList);
+
+		// combine them into closestEdge, a component points to the component
+		// at the other end of its closest edge
+		for (Integer i = 0; i < activeCount; i++) {
+			closestEdge[active[i] - start].from = UNSET_ELEMENT;
+		}
+		for (Integer i = 0; i < recieved; i++) {
+			ContractedEdge* record = &recieveBuffer[i];
+			Edge* closestOwned = &closestEdge[record->from - start];
+			if (lighterEdge(&record->edge, closestOwned)) {
+				*closestOwned = record->edge;
+				parents[record->from - start] = record->to;
+			}
+		}
+		free(recieveBuffer);
+
+		bool found = false;
+		for (Integer i = 0; i < activeCount && !found; i++) {
+			found = closestEdge[active[i] - start].from != UNSET_ELEMENT;
+		}
+		MPI_Allreduce(MPI_IN_PLACE, &found, 1, MPI_C_BOOL, MPI_LOR,
+				MPI_COMM_GRAPH);
+		countSentBytes(1, MPI_C_BOOL);
+		lapPhase(REDUCE_PHASE, &lap);
+		if (!found) {
+			// no component has an edge to another one
+			break;
+		}
+
+		// two components which chose each other share the same closest edge,
+		// the smaller one stays a root
+		Integer hooked = 0;
+		for (Integer i = 0; i < activeCount; i++) {
+			if (parents[active[i] - start] != active[i]) {
+				active[hooked] = active[i];
+				keys[hooked++] = parents[active[i] - start];
+			}
+		}
+		lookupOwnedValues(keys, values, hooked, parents, vertices);
+		for (Integer i = 0; i < hooked; i++) {
+			if (values[i] == active[i] && active[i] < keys[i]) {
+				parents[active[i] - start] = active[i];
+			} else {
+				// add edge to MST
+				edgeListMST[edgesMST++] = closestEdge[active[i] - start];
+			}
+		}
+
+		// let every hooked component point to the root of its tree
+		bool changed;
+		do {
+			changed = false;
+			for (Integer i = 0; i < hooked; i++) {
+				keys[i] = parents[active[i] - start];
+			}
+			lookupOwnedValues(keys, values, hooked, parents, vertices);
+			for (Integer i = 0; i < hooked; i++) {
+				if (values[i] != keys[i]) {
+					parents[active[i] - start] = values[i];
+					changed = true;
+				}
+			}
+			MPI_Allreduce(MPI_IN_PLACE, &changed, 1, MPI_C_BOOL, MPI_LOR,
+					MPI_COMM_GRAPH);
+			countSentBytes(1, MPI_C_BOOL);
+		} while (changed);
+
+		// the remaining roots stay active
+		activeCount = 0;
+		for (Integer i = 0; i < owned; i++) {
+			if (parents[i] == start + i) {
+				active[activeCount++] = start + i;
+			}
+		}
+		lapPhase(UNION_PHASE, &lap);
+
+		// look up the new components of all endpoints
+		Integer* labels = (Integer*) malloc(
+				(edges > 0 ? 2 * edges : 1) * sizeof(Integer));
+		for (Integer i = 0; i < edges; i++) {
+			labels[2 * i] = edgeList[i].from;
+			labels[2 * i + 1] = edgeList[i].to;
+		}
+		qsort(labels, 2 * edges, sizeof(Integer), compareIntegers);
+		Integer distinct = 0;
+		for (Integer i = 0; i < 2 * edges; i++) {
+			if (i == 0 || labels[i] != labels[distinct - 1]) {
+				labels[distinct++] = labels[i];
+			}
+		}
+		Integer* roots = (Integer*) malloc((distinct > 0 ? distinct : 1)
+				* sizeof(Integer));
+		lookupOwnedValues(labels, roots, distinct, parents, vertices);
+		for (Integer i = 0; i < edges; i++) {
+			for (int k = 0; k < 2; k++) {
+				Integer* label = k == 0 ? &edgeList[i].from : &edgeList[i].to;
+				Integer* position = (Integer*) bsearch(label, labels, distinct,
+						sizeof(Integer), compareIntegers);
+				*label = roots[position - labels];
+			}
+		}
+		edges = reduceContractedEdges(edgeList, edges);
+		free(labels);
+		free(roots);
+		lapPhase(BROADCAST_PHASE, &lap);
+	}
+
+	// collect the MST on the first process
+	int edgesPart = edgesMST;
+	MPI_Gather(&edgesPart, 1, MPI_INT, recieveCounts, 1, MPI_INT, 0,
+			MPI_COMM_GRAPH);
+	countSentBytes(1, MPI_INT);
+	if (rank == 0) {
+		recieveOffsets[0] = 0;
+		for (int i = 1; i < size; i++) {
+			recieveOffsets[i] = recieveOffsets[i - 1] + recieveCounts[i - 1];
+		}
+		mst->edges = recieveOffsets[size - 1] + recieveCounts[size - 1];
+	}
+	MPI_Gatherv(edgeListMST, edgesPart, MPI_GRAPH_EDGE, mst->edgeList,
+			recieveCounts, recieveOffsets, MPI_GRAPH_EDGE, 0, MPI_COMM_GRAPH);
+	countSentBytes(edgesPart, MPI_GRAPH_EDGE);
+
+	// clean up
+	free(edgeList);
+	free(parents);
+	free(active);
+	free(closestEdge);
+	free(keys);
+	free(values);
+	free(edgeListMST);
+	free(sendCounts);
+	free(sendOffsets);
+	free(recieveCounts);
+	free(recieveOffsets);
+	MPI_Type_free(&MPI_CONTRACTED_EDGE);
+}
+
+/*
+ * find a MST of the graph using Filter-Kruskal, which only sorts the edges
+ * that may still be part of the MST
+ */
+void mstFilterKruskal(WeightedGraph* graph, WeightedGraph* mst,
+		Scratch* scratch) {
+	int rank;
+	MPI_Comm_rank(MPI_COMM_GRAPH, &rank);
+
+	if (rank == 0) {
+		// create needed data structures
+		Set* set = scratchSet(scratch, graph->vertices);
+
+		Integer edgesMST = 0;
+		filterKruskal(graph->edgeList, graph->edges, set, mst, &edgesMST);
+		mst->edges = edgesMST;
+	}
+}
+
+/*
+ * find a MST (or a spanning forest for disconnected graphs) of the graph
+ * using Kruskal's algorithm
+ */
+void mstKruskal(WeightedGraph* graph, WeightedGraph* mst, Scratch* scratch) {
+	int rank;
+	int size;
+	MPI_Comm_rank(MPI_COMM_GRAPH, &rank);
+	MPI_Comm_size(MPI_COMM_GRAPH, &size);
+
+	if (size != 1) {
+		// every process scans its part of the edges
+		distributeEdgeList(graph);
+	}
+
+	// create needed data structures
+	Set* set = scratchSet(scratch, graph->vertices);
+
+	Integer edgesMST = 0;
+	if (size == 1) {
+		// sort lazily, edges behind the last MST edge are never sorted
+		addUnsortedEdges(graph->edgeList, graph->edges, set, mst, &edgesMST);
+	} else {
+		// every process finds the spanning forest of its part of the edges,
+		// the other edges close a cycle and can't be part of the MST
+		WeightedGraph* forest = &(WeightedGraph ) { .partitioned = false,
+						.edges = 0, .vertices = 0, .edgeList = NULL,
+						.mappingSize = 0, .mapping = NULL };
+		newWeightedGraph(forest, graph->vertices,
+				graph->vertices > 0 ? graph->vertices - 1 : 0);
+		forest->edges = 0;
+		addUnsortedEdges(graph->edgeList, graph->edges, set, forest,
+				&forest->edges);
+
+		// every process gets a sorted weight range of the forest edges and
+		// adds them in order to the components of the lighter ranges
+		sampleSort(forest);
+		scanSpanningForests(forest, set);
+		WeightedGraph* part = &(WeightedGraph ) { .partitioned = false,
+						.edges = 0, .vertices = 0, .edgeList = NULL,
+						.mappingSize = 0, .mapping = NULL };
+		newWeightedGraph(part, forest->vertices, forest->edges);
+		part->partitioned = true;
+		part->edges = 0;
+		addSortedEdges(forest->edgeList, forest->edges, set, part,
+				&part->edges);
+
+		// the ranges are ordered, so the first process gets the sorted MST
+		gatherEdgeList(part);
+		if (rank == 0) {
+			memcpy(mst->edgeList, part->edgeList, part->edges * sizeof(Edge));
+			edgesMST = part->edges;
+		}
+		deleteWeightedGraph(forest);
+		deleteWeightedGraph(part);
+	}
+	if (rank == 0) {
+		// fewer edges for a spanning forest of a disconnected graph
+		mst->edges = edgesMST;
+	}
+}
+
+/*
+ * find a MST of the graph using Prim's algorithm with a binary heap, the
+ * processes share the work by vertex blocks
+ */
+void mstPrimBinary(const WeightedGraph* graph, WeightedGraph* mst,
+		Scratch* scratch) {
+	mstPrimPartitioned(graph, mst, primBinary, scratch);
+}
+
+/*
+ * find a MST of the graph using Prim's algorithm with a bucket queue, graphs
+ * with a large range of weights use the binary heap instead
+ */
+void mstPrimBucket(const WeightedGraph* graph, WeightedGraph* mst,
+		Scratch* scratch) {
+	int rank;
+	MPI_Comm_rank(MPI_COMM_GRAPH, &rank);
+
+	if (rank == 0) {
+		// find the range of the weights
+		Weight minimum = WEIGHT_MAXIMUM;
+		Weight maximum = WEIGHT_MINIMUM;
+		for (Integer i = 0; i < graph->edges; i++) {
+			Weight weight = graph->edgeList[i].weight;
+			minimum = weight < minimum ? weight : minimum;
+			maximum = weight > maximum ? weight : maximum;
+		}
+		if (graph->edges > 0
+				&& (uint64_t) maximum - (uint64_t) minimum
+						>= (uint64_t) BUCKET_QUEUE_RANGE) {
+			// one bucket per weight would need too much memory
+			primBinary(graph, mst, scratch);
+			return;
+		}
+
+		// create needed data structures
+		AdjacencyList* list = &(AdjacencyList ) { .elements = 0, .offsets =
+				NULL, .neighbors = NULL };
+		newAdjacencyList(list, graph);
+
+		BucketQueue* queue = &(BucketQueue ) { .minimum = 0, .range = 0,
+				.current = 0, .size = 0, .buckets = NULL, .next = NULL,
+				.previous = NULL, .keys = NULL, .vias = NULL };
+		newBucketQueue(queue, graph->vertices,
+				graph->edges > 0 ? minimum : 0,
+				graph->edges > 0 ? maximum - minimum + 1 : 1);
+		uint64_t* inTree = (uint64_t*) calloc(((size_t) graph->vertices + 63) / 64,
+				sizeof(uint64_t));
+
+		Integer vertex;
+		Integer via;
+		Integer weight;
+		Integer edgesMST = 0;
+		double lap = MPI_Wtime();
+		for (Integer start = 0; start < graph->vertices; start++) {
+			if (getBit(inTree, start)) {
+				continue;
+			}
+
+			// vertices only enter the queue once they are reached, each start
+			// vertex which isn't in a tree yet grows a new tree
+			pushBucketQueue(queue, start, UNSET_ELEMENT, queue->minimum);
+			while (queue->size > 0) {
+				popBucketQueue(queue, &vertex, &via, &weight);
+				setBit(inTree, vertex);
+				if (via != UNSET_ELEMENT) {
+					// add edge from queue to MST
+					mst->edgeList[edgesMST++] = (Edge ) { .from = vertex,
+									.to = via, .weight = weight };
+				}
+
+				// update queue
+				for (Integer i = list->offsets[vertex];
+						i < list->offsets[vertex + 1];
+						i++) {
+					if (!getBit(inTree, list->neighbors[i].vertex)) {
+						decreaseBucketQueue(queue, list->neighbors[i].vertex, vertex,
+								list->neighbors[i].weight);
+					}
+				}
+			}
+		}
+		mst->edges = edgesMST;
+		lapPhase(HEAP_PHASE, &lap);
+
+		// clean up
+		deleteAdjacencyList(list);
+		deleteBucketQueue(queue);
+		free(inTree);
+	}
+}
+
+/*
+ * find a MST of the graph using Prim's algorithm with a d-ary heap
+ */
+void mstPrimDary(const WeightedGraph* graph, WeightedGraph* mst,
+		const int arity) {
+	int rank;
+	MPI_Comm_rank(MPI_COMM_GRAPH, &rank);
+
+	if (rank == 0) {
+		// create needed data structures
+		AdjacencyList* list = &(AdjacencyList ) { .elements = 0, .offsets =
+				NULL, .neighbors = NULL };
+		newAdjacencyList(list, graph);
+
+		DaryMinHeap* heap = &(DaryMinHeap ) { .alloced = 0, .arity = 0, .size =
+				0, .keys = NULL, .vertices = NULL, .vias = NULL, .positions =
+				NULL };
+		newDaryMinHeap(heap, arity, graph->vertices);
+		uint64_t* inTree = (uint64_t*) calloc(((size_t) graph->vertices + 63) / 64,
+				sizeof(uint64_t));
+
+		Integer vertex;
+		Integer via;
+		Integer weight;
+		Integer edgesMST = 0;
+		double lap = MPI_Wtime();
+		for (Integer start = 0; start < graph->vertices; start++) {
+			if (getBit(inTree, start)) {
+				continue;
+			}
+
+			// vertices only enter the heap once they are reached, each start
+			// vertex which isn't in a tree yet grows a new tree
+			pushDaryMinHeap(heap, start, UNSET_ELEMENT, 0);
+			while (heap->size > 0) {
+				popDaryMinHeap(heap, &vertex, &via, &weight);
+				setBit(inTree, vertex);
+				if (via != UNSET_ELEMENT) {
+					// add edge from heap to MST
+					mst->edgeList[edgesMST++] = (Edge ) { .from = vertex,
+									.to = via, .weight = weight };
+				}
+
+				// update heap
+				for (Integer i = list->offsets[vertex];
+						i < list->offsets[vertex + 1];
+						i++) {
+					if (!getBit(inTree, list->neighbors[i].vertex)) {
+						decreaseDaryMinHeap(heap, list->neighbors[i].vertex, vertex,
+								list->neighbors[i].weight);
+					}
+				}
+			}
+		}
+		mst->edges = edgesMST;
+		lapPhase(HEAP_PHASE, &lap);
+
+		// clean up
+		deleteAdjacencyList(list);
+		deleteDaryMinHeap(heap);
+		free(inTree);
+	}
+}
+
+/*
+ * find a MST of the graph using Prim's algorithm with a fibonacci heap, the
+ * processes share the work by vertex blocks
+ */
+void mstPrimFibonacci(const WeightedGraph* graph, WeightedGraph* mst,
+		Scratch* scratch) {
+	mstPrimPartitioned(graph, mst, primFibonacci, scratch);
+}
+
+/*
+ * find a MST of the graph using Prim's algorithm on every process for the
+ * edges inside its block of the vertices, the edges between the blocks and the
+ * spanning forests of the blocks contain the MST, which the first process
+ * finds with Kruskal's algorithm
+ */
+void mstPrimPartitioned(const WeightedGraph* graph, WeightedGraph* mst,
+		void (*prim)(const WeightedGraph*, WeightedGraph*, Scratch*),
+		Scratch* scratch) {
+	int rank;
+	int size;
+	MPI_Comm_rank(MPI_COMM_GRAPH, &rank);
+	MPI_Comm_size(MPI_COMM_GRAPH, &size);
+
+	if (size == 1) {
+		prim(graph, mst, scratch);
+		return;
+	}
+
+	double lap = MPI_Wtime();
+	Integer vertices = graph->vertices;
+	MPI_Bcast(&vertices, 1, MPI_GRAPH_INTEGER, 0, MPI_COMM_GRAPH);
+	if (rank == 0) {
+		countSentBytes(1, MPI_GRAPH_INTEGER);
+	}
+	Integer start;
+	Integer owned;
+	partitionRange(vertices, rank, size, &start, &owned);
+
+	// split the edges into those inside a block, grouped by block, and those
+	// between blocks, whole edges are sent so counts and offsets are numbers
+	// of edges
+	int* sendCounts = (int*) calloc(size, sizeof(int));
+	int* offsets = (int*) malloc(size * sizeof(int));
+	Edge* innerEdges = NULL;
+	Edge* candidates = NULL;
+	Integer boundaryEdges = 0;
+	if (rank == 0) {
+		for (Integer i = 0; i < graph->edges; i++) {
+			int from = partitionOwner(vertices, size, graph->edgeList[i].from);
+			if (from == partitionOwner(vertices, size, graph->edgeList[i].to)) {
+				sendCounts[from]++;
+			} else {
+				boundaryEdges++;
+			}
+		}
+		offsets[0] = 0;
+		for (int i = 1; i < size; i++) {
+			offsets[i] = offsets[i - 1] + sendCounts[i - 1];
+		}
+
+		int* positions = (int*) malloc(size * sizeof(int));
+		memcpy(positions, offsets, size * sizeof(int));
+		innerEdges = (Edge*) malloc(
+				(graph->edges - boundaryEdges > 0 ?
+						graph->edges - boundaryEdges : 1) * sizeof(Edge));
+		candidates = (Edge*) malloc(
+				((long) boundaryEdges + vertices > 0 ?
+						(long) boundaryEdges + vertices : 1) * sizeof(Edge));
+		Integer boundary = 0;
+		for (Integer i = 0; i < graph->edges; i++) {
+			Edge* edge = &graph->edgeList[i];
+			int from = partitionOwner(vertices, size, edge->from);
+			if (from == partitionOwner(vertices, size, edge->to)) {
+				innerEdges[positions[from]++] = *edge;
+			} else {
+				candidates[boundary++] = *edge;
+			}
+		}
+		free(positions);
+	}
+
+	// send every process the edges inside its block
+	int blockEdges;
+	MPI_Scatter(sendCounts, 1, MPI_INT, &blockEdges, 1, MPI_INT, 0,
+			MPI_COMM_GRAPH);
+	if (rank == 0) {
+		countSentBytes(size, MPI_INT);
+	}
+	WeightedGraph* block = &(WeightedGraph ) { .partitioned = false, .edges =
+					0, .vertices = 0, .edgeList = NULL, .mappingSize = 0,
+					.mapping = NULL };
+	newWeightedGraph(block, owned, blockEdges);
+	MPI_Scatterv(innerEdges, sendCounts, offsets, MPI_GRAPH_EDGE,
+			block->edgeList, blockEdges, MPI_GRAPH_EDGE, 0, MPI_COMM_GRAPH);
+	if (rank == 0) {
+		countSentBytes(sumCounts(sendCounts, size), MPI_GRAPH_EDGE);
+	}
+	free(innerEdges);
+	lapPhase(SCATTER_PHASE, &lap);
+
+	// find the spanning forest of the block with vertices counted from its
+	// start
+	for (Integer i = 0; i < block->edges; i++) {
+		block->edgeList[i].from -= start;
+		block->edgeList[i].to -= start;
+	}
+	WeightedGraph* forest = &(WeightedGraph ) { .partitioned = false, .edges =
+					0, .vertices = 0, .edgeList = NULL, .mappingSize = 0,
+					.mapping = NULL };
+	newWeightedGraph(forest, owned, owned > 0 ? owned - 1 : 0);
+	prim(block, forest, scratch);
+	for (Integer i = 0; i < forest->edges; i++) {
+		forest->edgeList[i].from += start;
+		forest->edgeList[i].to += start;
+	}
+
+	// collect the forests behind the edges between the blocks
+	lap = MPI_Wtime();
+	int forestEdges = forest->edges;
+	MPI_Gather(&forestEdges, 1, MPI_INT, sendCounts, 1, MPI_INT, 0,
+			MPI_COMM_GRAPH);
+	countSentBytes(1, MPI_INT);
+	if (rank == 0) {
+		offsets[0] = boundaryEdges;
+		for (int i = 1; i < size; i++) {
+			offsets[i] = offsets[i - 1] + sendCounts[i - 1];
+		}
+	}
+	MPI_Gatherv(forest->edgeList, forestEdges, MPI_GRAPH_EDGE, candidates,
+			sendCounts, offsets, MPI_GRAPH_EDGE, 0, MPI_COMM_GRAPH);
+	countSentBytes(forestEdges, MPI_GRAPH_EDGE);
+
+	if (rank == 0) {
+		// the first process combines them to the MST
+		Set* set = scratchSet(scratch, vertices);
+		Integer edgesMST = 0;
+		addUnsortedEdges(candidates, offsets[size - 1] + sendCounts[size - 1],
+				set, mst, &edgesMST);
+		mst->edges = edgesMST;
+	}
+	lapPhase(MERGE_PHASE, &lap);
+
+	// clean up
+	deleteWeightedGraph(block);
+	deleteWeightedGraph(forest);
+	free(candidates);
+	free(sendCounts);
+	free(offsets);
+}
+
+/*
+ * the other endpoint of an edge seen from one of its incidences
+ */
+Integer neighborDynamicMst(const DynamicMst* mst, const Integer incidence) {
+	const Edge* edge = &mst->edgeList[incidence / 2];
+	return incidence % 2 == 0 ? edge->to : edge->from;
+}
+
+/*
+ * create compressed adjacency list with the neighbors of each vertex stored
+ * contiguously behind the neighbors of all prior vertices
+ */
+void newAdjacencyList(AdjacencyList* list, const WeightedGraph* graph) {
+	double lap = MPI_Wtime();
+	list->elements = graph->vertices;
+	list->offsets = (Integer*) calloc(list->elements + 1, sizeof(Integer));
+	list->neighbors = (ListElement*) malloc(
+			(size_t) graph->edges * 2 * sizeof(ListElement));
+
+	// count the degree of each vertex
+#pragma omp parallel for schedule(static)
+	for (Integer i = 0; i < graph->edges; i++) {
+#pragma omp atomic
+		list->offsets[graph->edgeList[i].from + 1]++;
+#pragma omp atomic
+		list->offsets[graph->edgeList[i].to + 1]++;
+	}
+	for (Integer i = 0; i < list->elements; i++) {
+		list->offsets[i + 1] += list->offsets[i];
+	}
+
+	// fill in the neighbors of both endpoints
+	Integer* positions = (Integer*) malloc(list->elements * sizeof(Integer));
+	memcpy(positions, list->offsets, list->elements * sizeof(Integer));
+#pragma omp parallel for schedule(static)
+	for (Integer i = 0; i < graph->edges; i++) {
+		Integer from = graph->edgeList[i].from;
+		Integer to = graph->edgeList[i].to;
+		Weight weight = graph->edgeList[i].weight;
+		Integer positionFrom;
+		Integer positionTo;
+#pragma omp atomic capture
+		positionFrom = positions[from]++;
+#pragma omp atomic capture
+		positionTo = positions[to]++;
+		list->neighbors[positionFrom] = (ListElement ) { .vertex = to,
+						.weight = weight };
+		list->neighbors[positionTo] = (ListElement ) { .vertex = from,
+						.weight = weight };
+	}
+
+	// clean up
+	free(positions);
+	lapPhase(ADJACENCY_PHASE, &lap);
+}
+
+/*
+ * create binary min heap for the vertices smaller than elements
+ */
+void newBinaryMinHeap(BinaryMinHeap* heap, const Integer elements) {
+	int startSize = 4;
+	heap->alloced = startSize;
+	heap->size = 0;
+	heap->positions = (Integer*) malloc((elements > 0 ? elements : 1)
+			* sizeof(Integer));
+	memset(heap->positions, UNSET_ELEMENT, elements * sizeof(Integer));
+	heap->elements = (BinaryHeapElement*) malloc(
+			startSize * sizeof(BinaryHeapElement));
+}
+
+/*
+ * create bucket queue with one bucket per weight from minimum to
+ * minimum + range - 1 for the vertices smaller than elements
+ */
+void newBucketQueue(BucketQueue* queue, const Integer elements,
+		const Integer minimum, const Integer range) {
+	queue->minimum = minimum;
+	queue->range = range;
+	queue->current = range;
+	queue->size = 0;
+	queue->buckets = (Integer*) malloc(range * sizeof(Integer));
+	memset(queue->buckets, UNSET_ELEMENT, range * sizeof(Integer));
+	queue->next = (Integer*) malloc((elements > 0 ? elements : 1)
+			* sizeof(Integer));
+	queue->previous = (Integer*) malloc((elements > 0 ? elements : 1)
+			* sizeof(Integer));
+	queue->keys = (Integer*) malloc((elements > 0 ? elements : 1)
+			* sizeof(Integer));
+	memset(queue->keys, UNSET_ELEMENT, elements * sizeof(Integer));
+	queue->vias = (Integer*) malloc((elements > 0 ? elements : 1)
+			* sizeof(Integer));
+}
+
+/*
+ * create d-ary min heap for the vertices smaller than elements, every vertex
+ * is at most once in the heap so its size is fixed
+ */
+void newDaryMinHeap(DaryMinHeap* heap, const int arity,
+		const Integer elements) {
+	heap->alloced = elements > 0 ? elements : 1;
+	heap->arity = arity;
+	heap->size = 0;
+
+	// the keys are stored apart from the payload, arity - 1 unused keys in
+	// front let the children of every element start at a multiple of arity
+	void* keys;
+	if (posix_memalign(&keys, CACHE_LINE_SIZE,
+			((size_t) heap->alloced + arity - 1) * sizeof(Integer)) != 0) {
+		fprintf(stderr, "Couldn't allocate d-ary heap, exiting!\n");
+		exit(EXIT_FAILURE);
+	}
+	heap->keys = (Integer*) keys + arity - 1;
+	heap->vertices = (Integer*) malloc(heap->alloced * sizeof(Integer));
+	heap->vias = (Integer*) malloc(heap->alloced * sizeof(Integer));
+	heap->positions = (Integer*) malloc(heap->alloced * sizeof(Integer));
+	memset(heap->positions, UNSET_ELEMENT, heap->alloced * sizeof(Integer));
+}
+
+/*
+ * create a dynamic MST of the graph from its spanning forest
+ */
+void newDynamicMst(DynamicMst* mst, const WeightedGraph* graph,
+		const WeightedGraph* tree) {
+	mst->vertices = graph->vertices;
+	mst->edges = 0;
+	mst->alloced = graph->edges > 0 ? graph->edges : 1;
+	mst->freeEdge = UNSET_ELEMENT;
+	mst->weight = 0;
+	size_t nodes = (size_t) mst->vertices + mst->alloced;
+	size_t words = ((size_t) mst->alloced + 63) / 64;
+	mst->edgeList = (Edge*) malloc((size_t) mst->alloced * sizeof(Edge));
+	mst->inTree = (uint64_t*) calloc(words, sizeof(uint64_t));
+	mst->touched = (uint64_t*) calloc(words, sizeof(uint64_t));
+	mst->heads = (Integer*) malloc(
+			(mst->vertices > 0 ? mst->vertices : 1) * sizeof(Integer));
+	memset(mst->heads, UNSET_ELEMENT, mst->vertices * sizeof(Integer));
+	mst->next = (Integer*) malloc(2 * (size_t) mst->alloced * sizeof(Integer));
+	mst->previous = (Integer*) malloc(
+			2 * (size_t) mst->alloced * sizeof(Integer));
+	mst->children = (Integer*) malloc(2 * nodes * sizeof(Integer));
+	memset(mst->children, UNSET_ELEMENT, 2 * nodes * sizeof(Integer));
+	mst->parents = (Integer*) malloc(nodes * sizeof(Integer));
+	memset(mst->parents, UNSET_ELEMENT, nodes * sizeof(Integer));
+	mst->heaviest = (Integer*) malloc(nodes * sizeof(Integer));
+	memset(mst->heaviest, UNSET_ELEMENT, nodes * sizeof(Integer));
+	mst->flipped = (bool*) calloc(nodes, sizeof(bool));
+	mst->stack = (Integer*) malloc(nodes * sizeof(Integer));
+	mst->labels = (Integer*) malloc(
+			(mst->vertices > 0 ? mst->vertices : 1) * sizeof(Integer));
+	memset(mst->labels, UNSET_ELEMENT, mst->vertices * sizeof(Integer));
+	mst->queue = (Integer*) malloc(
+			2 * (mst->vertices > 0 ? mst->vertices : 1) * sizeof(Integer));
+	mst->changes = 0;
+	mst->changesAlloced = 1;
+	mst->changeList = (EdgeChange*) malloc(sizeof(EdgeChange));
+
+	for (Integer i = 0; i < graph->edges; i++) {
+		addDynamicEdge(mst, graph->edgeList[i].from, graph->edgeList[i].to,
+				graph->edgeList[i].weight);
+	}
+
+	// the tree edges are copies, so look for an edge of the same weight
+	for (Integer i = 0; i < tree->edges; i++) {
+		Integer from = tree->edgeList[i].from;
+		Integer to = tree->edgeList[i].to;
+		Integer incidence = mst->heads[from];
+		for (; incidence != UNSET_ELEMENT; incidence = mst->next[incidence]) {
+			Integer edge = incidence / 2;
+			if (neighborDynamicMst(mst, incidence) == to
+					&& mst->edgeList[edge].weight == tree->edgeList[i].weight
+					&& !getBit(mst->inTree, edge)) {
+				setBit(mst->inTree, edge);
+				mst->weight += mst->edgeList[edge].weight;
+				break;
+			}
+		}
+		if (incidence == UNSET_ELEMENT) {
+			fprintf(stderr, "MST edge isn't in the graph, exiting!\n");
+			exit(EXIT_FAILURE);
+		}
+	}
+
+	// every node starts as a splay tree of its own, hanging below the edge to
+	// its parent in a breadth first search of its tree, which hangs below the
+	// parent vertex
+	for (Integer root = 0; root < mst->vertices; root++) {
+		if (mst->labels[root] != UNSET_ELEMENT) {
+			continue;
+		}
+		Integer head = 0;
+		Integer tail = 1;
+		mst->queue[0] = root;
+		mst->labels[root] = 0;
+		while (head < tail) {
+			Integer vertex = mst->queue[head++];
+			for (Integer i = mst->heads[vertex]; i != UNSET_ELEMENT;
+					i = mst->next[i]) {
+				Integer neighbor = neighborDynamicMst(mst, i);
+				if (getBit(mst->inTree, i / 2)
+						&& mst->labels[neighbor] == UNSET_ELEMENT) {
+					mst->labels[neighbor] = 0;
+					mst->parents[neighbor] = mst->vertices + i / 2;
+					mst->parents[mst->vertices + i / 2] = vertex;
+					mst->queue[tail++] = neighbor;
+				}
+			}
+		}
+	}
+	memset(mst->labels, UNSET_ELEMENT, mst->vertices * sizeof(Integer));
+}
+
+/*
+ * create fibonacci min heap element
+ */
+void newFibonacciHeapElement(FibonacciHeapElement* element,
+		const Integer vertex, const Integer via, const Integer weight,
+		const Integer left, const Integer right, const Integer parent,
+		const Integer child) {
+	element->childrens = 0;
+	element->marked = false;
+	element->vertex = vertex;
+	element->via = via;
+	element->weight = weight;
+	element->parent = parent;
+	element->child = child;
+	element->left = left;
+	element->right = right;
+}
+
+/*
+ * create fibonacci min heap for vertices smaller than elements
+ */
+void newFibonacciMinHeap(FibonacciMinHeap* heap, const Integer elements) {
+	// one slab for all elements, elements are linked by their index
+	heap->alloced = elements > 0 ? elements : 1;
+	heap->size = 0;
+	heap->used = 0;
+	heap->minimum = UNSET_ELEMENT;
+	heap->degree = (Integer*) malloc(
+			(2 * log2(heap->alloced) + 2) * sizeof(Integer));
+	heap->positions = (Integer*) malloc(heap->alloced * sizeof(Integer));
+	memset(heap->positions, UNSET_ELEMENT, heap->alloced * sizeof(Integer));
+	heap->elements = (FibonacciHeapElement*) malloc(
+			heap->alloced * sizeof(FibonacciHeapElement));
+}
+
+/*
+ * create the datatype of a record with some integers in front and one other
+ * member at the offset, the extent is the size of the record so arrays of
+ * records can be sent
+ */
+MPI_Datatype newRecordType(const int integers, const MPI_Aint offset,
+		MPI_Datatype member, const MPI_Aint size) {
+	MPI_Datatype record;
+	MPI_Datatype resized;
+	MPI_Type_create_struct(2, (int[] ) { integers, 1 },
+			(MPI_Aint[] ) { 0, offset },
+			(MPI_Datatype[] ) { MPI_GRAPH_INTEGER, member }, &record);
+	MPI_Type_create_resized(record, 0, size, &resized);
+	MPI_Type_free(&record);
+	MPI_Type_commit(&resized);
+	return resized;
+}
+
+/*
+ * initialize and allocate memory for the members of the graph
+ */
+void newSet(Set* set, const Integer elements) {
+	set->elements = elements;
+	set->parents = (Integer*) malloc(elements * sizeof(Integer));
+	// every element starts as a root of a component of size one
+	memset(set->parents, UNSET_ELEMENT, elements * sizeof(Integer));
+}
+
+/*
+ * initialize and allocate memory for the members of the graph
+ */
+void newWeightedGraph(WeightedGraph* graph, const Integer vertices,
+		const Integer edges) {
+	graph->partitioned = false;
+	graph->edges = edges;
+	graph->vertices = vertices;
+	graph->edgeList = (Edge*) calloc(edges, sizeof(Edge));
+	graph->mappingSize = 0;
+	graph->mapping = NULL;
+}
+
+/*
+ * open a hardware counter of the cache misses of this process, returns -1 if
+ * there is none (not Linux, no permission or no hardware support)
+ */
+int openCacheMissCounter() {
+#ifdef __linux__
+	struct perf_event_attr attributes;
+	memset(&attributes, 0, sizeof(attributes));
+	attributes.type = PERF_TYPE_HARDWARE;
+	attributes.size = sizeof(attributes);
+	attributes.config = PERF_COUNT_HW_CACHE_MISSES;
+	attributes.disabled = 1;
+	attributes.exclude_kernel = 1;
+	attributes.exclude_hv = 1;
+	return (int) syscall(SYS_perf_event_open, &attributes, 0, -1, -1, 0);
+#else
+	return -1;
+#endif
+}
+
+/*
+ * parse the "from to weight" lines between start and end into the edge list
+ * starting at firstEdge, returns false on malformed lines
+ */
+bool parseEdges(const char* start, const char* end, WeightedGraph* graph,
+		const Integer firstEdge) {
+	const char* position = start;
+	for (Integer i = firstEdge; i < graph->edges; i++) {
+		// skip empty lines
+		while (position < end
+				&& (*position == ' ' || *position == '\t' || *position == '\r'
+						|| *position == '\n')) {
+			position++;
+		}
+		if (position == end) {
+			break;
+		}
+
+		Integer from;
+		Integer to;
+		Integer weight;
+		if (!parseInteger(&position, end, &from)
+				|| !parseInteger(&position, end, &to)
+				|| !parseInteger(&position, end, &weight)) {
+			return false;
+		}
+
+		// exactly one edge per line with vertices of the graph and a weight
+		// of the weight type
+		while (position < end
+				&& (*position == ' ' || *position == '\t' || *position == '\r')) {
+			position++;
+		}
+		if ((position < end && *position != '\n') || from < 0
+				|| from >= graph->vertices || to < 0 || to >= graph->vertices
+				|| weight < WEIGHT_MINIMUM || weight > WEIGHT_MAXIMUM) {
+			return false;
+		}
+		graph->edgeList[i] = (Edge ) { .from = from, .to = to, .weight =
+						weight };
+	}
+
+	return true;
+}
+
+/*
+ * parse a decimal integer after optional blanks and advance the position,
+ * returns false if there is none
+ */
+bool parseInteger(const char** position, const char* end, Integer* value) {
+	const char* current = *position;
+	while (current < end && (*current == ' ' || *current == '\t')) {
+		current++;
+	}
+
+	bool negative = current < end && *current == '-';
+	if (negative) {
+		current++;
+	}
+	if (current == end || *current < '0' || *current > '9') {
+		return false;
+	}
+
+	Integer result = 0;
+	for (; current < end && *current >= '0' && *current <= '9'; current++) {
+		int digit = *current - '0';
+		if (result > (INTEGER_MAXIMUM - digit) / 10) {
+			// overflow
+			return false;
+		}
+		result = result * 10 + digit;
+	}
+
+	*value = negative ? -result : result;
+	*position = current;
+	return true;
+}
+
+/*
+ * whether an algorithm only needs every process to hold its part of the edges
+ * (Kruskal and Boruvka with several processes)
+ */
+bool partitionedAlgorithm(const int algorithm) {
+	int size;
+	MPI_Comm_size(MPI_COMM_GRAPH, &size);
+
+	return size != 1 && (algorithm == 0 || algorithm == 3 || algorithm == 7);
+}
+
+/*
+ * move every edge to the process owning the block of vertices of its smaller
+ * endpoint, then replace the edges inside each block by their spanning forest,
+ * the graph keeps its MST and becomes partitioned
+ */
+void partitionGraph(WeightedGraph* graph) {
+	int rank;
+	int size;
+	MPI_Comm_rank(MPI_COMM_GRAPH, &rank);
+	MPI_Comm_size(MPI_COMM_GRAPH, &size);
+
+	distributeEdgeList(graph);
+	double lap = MPI_Wtime();
+	Integer vertices = graph->vertices;
+	Integer start;
+	Integer owned;
+	partitionRange(vertices, rank, size, &start, &owned);
+
+	// group the edges by the owner of their smaller endpoint
+	int* sendCounts = (int*) calloc(size, sizeof(int));
+	int* sendOffsets = (int*) malloc(size * sizeof(int));
+	int* recieveCounts = (int*) malloc(size * sizeof(int));
+	int* recieveOffsets = (int*) malloc(size * sizeof(int));
+	int* owners = (int*) malloc(
+			(graph->edges > 0 ? graph->edges : 1) * sizeof(int));
+	for (Integer i = 0; i < graph->edges; i++) {
+		Edge* edge = &graph->edgeList[i];
+		owners[i] = partitionOwner(vertices, size,
+				edge->from < edge->to ? edge->from : edge->to);
+		sendCounts[owners[i]]++;
+	}
+	sendOffsets[0] = 0;
+	for (int i = 1; i < size; i++) {
+		sendOffsets[i] = sendOffsets[i - 1] + sendCounts[i - 1];
+	}
+	Edge* sendBuffer = (Edge*) malloc(
+			(graph->edges > 0 ? graph->edges : 1) * sizeof(Edge));
+	int* positions = (int*) malloc(size * sizeof(int));
+	memcpy(positions, sendOffsets, size * sizeof(int));
+	for (Integer i = 0; i < graph->edges; i++) {
+		sendBuffer[positions[owners[i]]++] = graph->edgeList[i];
+	}
+
+	// exchange the edges
+	MPI_Alltoall(sendCounts, 1, MPI_INT, recieveCounts, 1, MPI_INT,
+			MPI_COMM_GRAPH);
+	countSentBytes(size, MPI_INT);
+	recieveOffsets[0] = 0;
+	for (int i = 1; i < size; i++) {
+		recieveOffsets[i] = recieveOffsets[i - 1] + recieveCounts[i - 1];
+	}
+	Integer edges = recieveOffsets[size - 1] + recieveCounts[size - 1];
+	Edge* edgeList = (Edge*) malloc((edges > 0 ? edges : 1) * sizeof(Edge));
+	MPI_Alltoallv(sendBuffer, sendCounts, sendOffsets, MPI_GRAPH_EDGE,
+			edgeList, recieveCounts, recieveOffsets, MPI_GRAPH_EDGE,
+			MPI_COMM_GRAPH);
+	countSentBytes(sumCounts(sendCounts, size), MPI_GRAPH_EDGE);
+	free(sendBuffer);
+	free(owners);
+	lapPhase(SCATTER_PHASE, &lap);
+
+	// move the edges inside the block to the front, counted from its start
+	Integer inner = 0;
+	for (Integer i = 0; i < edges; i++) {
+		Edge* edge = &edgeList[i];
+		if (edge->from >= start && edge->from < start + owned
+				&& edge->to >= start && edge->to < start + owned) {
+			swapEdge(&edgeList[inner], edge);
+			edgeList[inner].from -= start;
+			edgeList[inner].to -= start;
+			inner++;
+		}
+	}
+
+	// the spanning forest of the block replaces its edges
+	Set* set = &(Set ) { .elements = 0, .parents = NULL };
+	newSet(set, owned);
+	WeightedGraph* forest = &(WeightedGraph ) { .partitioned = false, .edges =
+					0, .vertices = 0, .edgeList = NULL, .mappingSize = 0,
+					.mapping = NULL };
+	newWeightedGraph(forest, owned, owned > 0 ? owned - 1 : 0);
+	forest->edges = 0;
+	addUnsortedEdges(edgeList, inner, set, forest, &forest->edges);
+
+	deleteWeightedGraph(graph);
+	newWeightedGraph(graph, vertices, forest->edges + edges - inner);
+	graph->partitioned = true;
+	for (Integer i = 0; i < forest->edges; i++) {
+		graph->edgeList[i] = (Edge ) { .from = forest->edgeList[i].from + start,
+						.to = forest->edgeList[i].to + start, .weight =
+						forest->edgeList[i].weight };
+	}
+	memcpy(&graph->edgeList[forest->edges], &edgeList[inner],
+			(edges - inner) * sizeof(Edge));
+
+	// clean up
+	deleteSet(set);
+	deleteWeightedGraph(forest);
+	free(edgeList);
+	free(sendCounts);
+	free(sendOffsets);
+	free(recieveCounts);
+	free(recieveOffsets);
+	free(positions);
+}
+
+/*
+ * return the process whose range of a partition contains the element
+ */
+int partitionOwner(const Integer elements, const int size,
+		const Integer element) {
+	Integer elementsPart = elements / size;
+	Integer remainder = elements % size;
+	if (element < remainder * (elementsPart + 1)) {
+		return element / (elementsPart + 1);
+	} else {
+		return remainder + (element - remainder * (elementsPart + 1))
+				/ elementsPart;
+	}
+}
+
+/*
+ * split elements evenly between processes, returns the first element and the
+ * number of elements of the given process
+ */
+void partitionRange(const Integer elements, const int rank, const int size,
+		Integer* start, Integer* elementsPart) {
+	Integer remainder = elements % size;
+	*elementsPart = elements / size + (rank < remainder ? 1 : 0);
+	*start = rank * (elements / size) + (rank < remainder ? rank : remainder);
+}
+
+/*
+ * remove the minimum of the heap
+ */
+void popBinaryMinHeap(BinaryMinHeap* heap, Integer* vertex, Integer* via,
+		Integer* weight) {
+	*vertex = heap->elements[0].vertex;
+	*via = heap->elements[0].via;
+	*weight = heap->elements[0].weight;
+	heap->elements[0] = heap->elements[heap->size - 1];
+	heap->positions[heap->elements[0].vertex] = 0;
+	heap->positions[*vertex] = UNSET_ELEMENT;
+	heap->size--;
+	heapifyDownBinaryMinHeap(heap, 0);
+}
+
+/*
+ * remove an element of the lowest non-empty bucket
+ */
+void popBucketQueue(BucketQueue* queue, Integer* vertex, Integer* via,
+		Integer* weight) {
+	while (queue->buckets[queue->current] == UNSET_ELEMENT) {
+		queue->current++;
+	}
+
+	*vertex = queue->buckets[queue->current];
+	*via = queue->vias[*vertex];
+	*weight = queue->minimum + queue->current;
+	unlinkBucketQueue(queue, *vertex);
+	queue->keys[*vertex] = UNSET_ELEMENT;
+	queue->size--;
+}
+
+/*
+ * remove the minimum element of a d-ary heap
+ */
+void popDaryMinHeap(DaryMinHeap* heap, Integer* vertex, Integer* via,
+		Integer* weight) {
+	*vertex = heap->vertices[0];
+	*via = heap->vias[0];
+	*weight = heap->keys[0];
+	heap->positions[*vertex] = UNSET_ELEMENT;
+	heap->size--;
+
+	if (heap->size > 0) {
+		// move the last element to the root, then bubble down
+		heap->keys[0] = heap->keys[heap->size];
+		heap->vertices[0] = heap->vertices[heap->size];
+		heap->vias[0] = heap->vias[heap->size];
+		heapifyDownDaryMinHeap(heap, 0);
+	}
+}
+
+/*
+ * remove the minimum of the heap
+ */
+void popFibonacciMinHeap(FibonacciMinHeap* heap, Integer* vertex, Integer* via,
+		Integer* weight) {
+	FibonacciHeapElement* elements = heap->elements;
+	Integer minimumElement = heap->minimum;
+	if (minimumElement != UNSET_ELEMENT) {
+		// store the minimum
+		FibonacciHeapElement* minimum = &elements[minimumElement];
+		*vertex = minimum->vertex;
+		*via = minimum->via;
+		*weight = minimum->weight;
+
+		// add all childs of minimum to the parent list
+		for (Integer i = 0; i < minimum->childrens; i++) {
+			Integer child = minimum->child;
+			if (child == elements[child].right) {
+				minimum->child = UNSET_ELEMENT;
+			} else {
+				minimum->child = elements[child].right;
+				elements[elements[child].right].left = elements[child].left;
+				elements[elements[child].left].right = elements[child].right;
+			}
+			elements[child].parent = UNSET_ELEMENT;
+			elements[child].right = minimumElement;
+			elements[child].left = minimum->left;
+			elements[minimum->left].right = child;
+			minimum->left = child;
+		}
+
+		// remove minimum
+		if (minimumElement == minimum->right) {
+			heap->minimum = UNSET_ELEMENT;
+		} else {
+			elements[minimum->right].left = minimum->left;
+			elements[minimum->left].right = minimum->right;
+			heap->minimum = minimum->right;
+		}
+		heap->size--;
+		heap->positions[minimum->vertex] = UNSET_ELEMENT;
+		if (heap->size > 0) {
+			consolidateFibonacciMinHeap(heap);
+		}
+	}
+}
+
+/*
+ * find a spanning forest of the graph using Prim's algorithm with a binary heap
+ */
+void primBinary(const WeightedGraph* graph, WeightedGraph* mst,
+		Scratch* scratch) {
+	// create needed data structures
+	AdjacencyList* list = &(AdjacencyList ) { .elements = 0, .offsets =
+			NULL, .neighbors = NULL };
+	newAdjacencyList(list, graph);
+
+	BinaryMinHeap* heap = scratchBinaryMinHeap(scratch, graph->vertices);
+	uint64_t* inTree = (uint64_t*) calloc(((size_t) graph->vertices + 63) / 64,
+			sizeof(uint64_t));
+
+	Integer vertex;
+	Integer via;
+	Integer weight;
+	Integer edgesMST = 0;
+	double lap = MPI_Wtime();
+	for (Integer start = 0; start < graph->vertices; start++) {
+		if (getBit(inTree, start)) {
+			continue;
+		}
+
+		// vertices only enter the heap once they are reached, each start
+		// vertex which isn't in a tree yet grows a new tree
+		pushBinaryMinHeap(heap, start, UNSET_ELEMENT, 0);
+		while (heap->size > 0) {
+			popBinaryMinHeap(heap, &vertex, &via, &weight);
+			setBit(inTree, vertex);
+			if (via != UNSET_ELEMENT) {
+				// add edge from heap to MST
+				mst->edgeList[edgesMST++] = (Edge ) { .from = vertex, .to = via,
+								.weight = weight };
+			}
+
+			// update heap
+			for (Integer i = list->offsets[vertex];
+					i < list->offsets[vertex + 1];
+					i++) {
+				if (!getBit(inTree, list->neighbors[i].vertex)) {
+					decreaseBinaryMinHeap(heap, list->neighbors[i].vertex, vertex,
+							list->neighbors[i].weight);
+				}
+			}
+		}
+	}
+	mst->edges = edgesMST;
+	lapPhase(HEAP_PHASE, &lap);
+
+	// clean up
+	deleteAdjacencyList(list);
+	free(inTree);
+}
+
+/*
+ * find a spanning forest of the graph using Prim's algorithm with a fibonacci heap
+ */
+void primFibonacci(const WeightedGraph* graph, WeightedGraph* mst,
+		Scratch* scratch) {
+	// create needed data structures
+	AdjacencyList* list = &(AdjacencyList ) { .elements = 0, .offsets =
+			NULL, .neighbors = NULL };
+	newAdjacencyList(list, graph);
+
+	FibonacciMinHeap* heap = scratchFibonacciMinHeap(scratch,
+			graph->vertices);
+	uint64_t* inTree = (uint64_t*) calloc(((size_t) graph->vertices + 63) / 64,
+			sizeof(uint64_t));
+
+	Integer vertex;
+	Integer via;
+	Integer weight;
+	Integer edgesMST = 0;
+	double lap = MPI_Wtime();
+	for (Integer start = 0; start < graph->vertices; start++) {
+		if (getBit(inTree, start)) {
+			continue;
+		}
+
+		// vertices only enter the heap once they are reached, each start
+		// vertex which isn't in a tree yet grows a new tree
+		pushFibonacciMinHeap(heap, start, UNSET_ELEMENT, 0);
+		while (heap->size > 0) {
+			popFibonacciMinHeap(heap, &vertex, &via, &weight);
+			setBit(inTree, vertex);
+			if (via != UNSET_ELEMENT) {
+				// add edge from heap to MST
+				mst->edgeList[edgesMST++] = (Edge ) { .from = vertex, .to = via,
+								.weight = weight };
+			}
+
+			// update heap
+			for (Integer i = list->offsets[vertex];
+					i < list->offsets[vertex + 1];
+					i++) {
+				if (!getBit(inTree, list->neighbors[i].vertex)) {
+					decreaseFibonacciMinHeap(heap, list->neighbors[i].vertex, vertex,
+							list->neighbors[i].weight);
+				}
+			}
+		}
+	}
+	mst->edges = edgesMST;
+	lapPhase(HEAP_PHASE, &lap);
+
+	// clean up
+	deleteAdjacencyList(list);
+	free(inTree);
+}
+
+/*
+ * prints the adjacency list
+ */
+void printAdjacencyList(const AdjacencyList* list) {
+	for (Integer i = 0; i < list->elements; i++) {
+		printf("%" INTEGER_FORMAT ":", i);
+		for (Integer j = list->offsets[i]; j < list->offsets[i + 1]; j++) {
+			printf(" %" INTEGER_FORMAT "(%" WEIGHT_FORMAT ")",
+					list->neighbors[j].vertex, list->neighbors[j].weight);
+		}
+		printf("\n");
+	}
+}
+
+/*
+ * print binary min heap
+ */
+void printBinaryHeap(const BinaryMinHeap* heap) {
+	for (Integer i = 0; i < heap->size; i++) {
+		printf("[%" INTEGER_FORMAT "]%" INTEGER_FORMAT ": %" INTEGER_FORMAT "(%"
+				INTEGER_FORMAT ") ", heap->positions[heap->elements[i].vertex],
+				heap->elements[i].vertex, heap->elements[i].via,
+				heap->elements[i].weight);
+		if (log2(i + 2) == (Integer) log2(i + 2)) {
+			// line break after each stage
+			printf("\n");
+		}
+	}
+	printf("\n");
+}
+
+/*
+ * print fibonacci min heap
+ */
+void printFibonacciHeap(const FibonacciMinHeap* heap,
+		const Integer startElement) {
+	const FibonacciHeapElement* elements = heap->elements;
+	if (heap->size > 0) {
+		Integer currentElement = startElement;
+		printf("[%" INTEGER_FORMAT "]:", elements[startElement].vertex);
+		do {
+			printf(" (%d,%" INTEGER_FORMAT ")%" INTEGER_FORMAT "|%"
+					INTEGER_FORMAT "|%" INTEGER_FORMAT "",
+					elements[currentElement].marked,
+					elements[currentElement].childrens,
+					elements[currentElement].vertex,
+					elements[currentElement].via,
+					elements[currentElement].weight);
+			currentElement = elements[currentElement].right;
+		} while (currentElement != startElement);
+		printf("\n");
+		do {
+			if (elements[currentElement].child != UNSET_ELEMENT) {
+				printf("{%" INTEGER_FORMAT "}",
+						elements[currentElement].vertex);
+				printFibonacciHeap(heap, elements[currentElement].child);
+				printf("\n");
+			}
+			currentElement = elements[currentElement].right;
+		} while (currentElement != startElement);
+	} else {
+		printf("heap is empty!\n");
+	}
+}
+
+/*
+ * print the graph as a maze to console, the rows are rendered in bands from a
+ * bitmap of the edges and each band is written at once
+ */
+void printMaze(const WeightedGraph* graph, const int rows, const int columns) {
+	if (rows < 1 || columns < 1) {
+		return;
+	}
+	uint64_t* bitmap = (uint64_t*) calloc(
+			(2 * (size_t) rows * columns + 63) / 64, sizeof(uint64_t));
+	fillMazeBitmap(bitmap, graph, rows, columns);
+
+	// each vertex is represented as a plus sign, each edge as dash or pipe
+	long rowsMaze = 2L * rows - 1;
+	long lineLength = 2L * columns;
+	long bandRows = OUTPUT_BUFFER_SIZE / lineLength > 0 ?
+			OUTPUT_BUFFER_SIZE / lineLength : 1;
+	char* band = (char*) malloc(bandRows * lineLength * sizeof(char));
+	for (long bandStart = 0; bandStart < rowsMaze; bandStart += bandRows) {
+		long bandEnd = bandStart + bandRows < rowsMaze ?
+				bandStart + bandRows : rowsMaze;
+#pragma omp parallel for schedule(static)
+		for (long i = bandStart; i < bandEnd; i++) {
+			char* line = &band[(i - bandStart) * lineLength];
+			for (long j = 0; j < lineLength - 1; j++) {
+				if (!isMazePassage(bitmap, columns, i, j)) {
+					line[j] = EMPTY_FIELD;
+				} else if (i % 2 == 0) {
+					line[j] = j % 2 == 0 ? VERTEX : HORIZONTAL_EDGE;
+				} else {
+					line[j] = VERTICAL_EDGE;
+				}
+			}
+			line[lineLength - 1] = '\n';
+		}
+		fwrite(band, sizeof(char), (bandEnd - bandStart) * lineLength, stdout);
+	}
+
+	// clean up
+	free(band);
+	free(bitmap);
+}
+
+/*
+ * print a CSV line of the microbenchmark with the median time and cache misses
+ * of the trials per operation, the cache misses stay empty without a counter
+ */
+void printMicrobenchmark(const char* workload, const char* family,
+		const char* structure, const long operations, double* times,
+		double* misses, const int trials) {
+	qsort(times, trials, sizeof(double), compareDoubles);
+	qsort(misses, trials, sizeof(double), compareDoubles);
+	double time = (times[(trials - 1) / 2] + times[trials / 2]) / 2;
+	double miss = (misses[(trials - 1) / 2] + misses[trials / 2]) / 2;
+	long divisor = operations > 0 ? operations : 1;
+
+	printf("%s,%s,%s,%ld,%f,", workload, family, structure, operations,
+			1e9 * time / divisor);
+	if (miss >= 0) {
+		printf("%f", miss / divisor);
+	}
+	printf("\n");
+}
+
+/*
+ * print the components of the set
+ */
+void printSet(const Set* set) {
+	for (Integer i = 0; i < set->elements; i++) {
+		if (set->parents[i] < 0) {
+			printf("%" INTEGER_FORMAT ": root(%" INTEGER_FORMAT ")\n", i,
+					-set->parents[i]);
+		} else {
+			printf("%" INTEGER_FORMAT ": %" INTEGER_FORMAT "\n", i,
+					set->parents[i]);
+		}
+	}
+}
+
+/*
+ * print all edges of the graph in "from to weight" format
+ */
+void printWeightedGraph(const WeightedGraph* graph) {
+	writeEdges(graph, stdout);
+}
+
+/*
+ * process the command line parameters and return a Handle struct with them
+ */
+Handle processParameters(int argc, char* argv[]) {
+	Handle handle = { .algorithm = 0, .arity = 4, .columns = 3, .convert = false, .edges =
+			0, .family = GRID_GRAPH, .generate = false, .help = false, .maze =
+			false, .partition = false, .create = false, .rows = 2, .timings =
+			false, .verbose = false, .seed = time(NULL), .benchmark = false,
+			.microbenchmark = false, .trials = 0, .binaryFile = NULL,
+			.graphFile = "maze.bin", .timingsFile = NULL, .update = false,
+			.updateFile = NULL, .server = false, .image = false, .imageFile =
+			NULL, .output = false, .outputFile = NULL };
+
+	for (int currentArgument = 1; currentArgument < argc; currentArgument++) {
+		switch (argv[currentArgument][1]) {
+		case 'a':
+			// choose algorithm
+			handle.algorithm = atoi(&argv[currentArgument + 1][0]);
+			currentArgument++;
+			break;
+		case 'b':
+			// benchmark all algorithms
+			handle.trials = atoi(&argv[currentArgument + 1][0]);
+			if (handle.trials < 1) {
+				fprintf(stderr, "Wrong number of trials: %s\n"
+						"-h for help\n", argv[currentArgument + 1]);
+				exit(EXIT_FAILURE);
+			}
+			handle.benchmark = true;
+			currentArgument++;
+			break;
+		case 'c':
+			// set number of columns
+			handle.columns = atoi(&argv[currentArgument + 1][0]);
+			currentArgument++;
+			break;
+		case 'd':
+			// set number of children of the d-ary heap
+			handle.arity = atoi(&argv[currentArgument + 1][0]);
+			if (handle.arity < 2) {
+				fprintf(stderr, "Wrong heap arity: %s\n"
+						"-h for help\n", argv[currentArgument + 1]);
+				exit(EXIT_FAILURE);
+			}
+			currentArgument++;
+			break;
+		case 'e':
+			// set number of edges of random graphs
+			handle.edges = atoi(&argv[currentArgument + 1][0]);
+			currentArgument++;
+			break;
+		case 'f':
+			// set graph file location
+			handle.graphFile = &argv[currentArgument + 1][0];
+			currentArgument++;
+			break;
+		case 'g':
+			// generate the graph in memory
+			handle.family = atoi(&argv[currentArgument + 1][0]);
+			handle.generate = true;
+			currentArgument++;
+			break;
+		case 'h':
+			// print help message
+			printf(
+					"Parameters:\n"
+							"\t-a <int>\tchoose algorithm: 0 Kruskal (default), 1 Prim (Fibonacci), 2 Prim (Binary), 3 Boruvka, 4 Filter-Kruskal, 5 Prim (d-ary), 6 Prim (bucket queue), 7 Boruvka (distributed vertices)\n"
+							"\t-b <int>\tbenchmark all algorithms with <int> trials on generated graphs of -r rows and -c columns and larger ones, with 1, 2, 4 ... processes\n"
+							"\t-c <int>\tset number of columns (default: 3)\n"
+							"\t-d <int>\tset number of children of the d-ary heap (default: 4)\n"
+							"\t-e <int>\tset number of edges of random graphs (default: 2 * rows * columns)\n"
+							"\t-g <int>\tgenerate the graph in memory instead of reading a file: 0 grid (default), 1 random, 2 R-MAT (rows * columns vertices)\n"
+							"\t-h\t\tprint this help message\n"
+							"\t-i <file>\tafterwards apply the batches of edge updates in <file> to the MST and print the changed MST edges of each batch, lines \"from to weight\" insert an edge or change its weight, lines \"from to\" delete it, empty lines end a batch\n"
+							"\t-j\t\tkeep running and answer jobs \"graph file [algorithm]\" from the standard input, one per line, with one result line each, the other parameters apply to all jobs\n"
+							"\t-m\t\tprint the resulting maze to console at the end (correct number of rows and columns needed!)\n"
+							"\t-n\t\tcreate a new maze file\n"
+							"\t-o <file>\twrite the MST to <file> (binary format for *.bin, text otherwise)\n"
+							"\t-p\t\tcontract blocks of vertices to their spanning forests before Kruskal or Boruvka with several processes\n"
+							"\t-r <int>\tset number of rows (default: 2)\n"
+							"\t-s <int>\tset the seed for new maze files and generated graphs (default: current time)\n"
+							"\t-t <file>\twrite the timings of the phases and the counters of all processes to <file> (JSON for *.json, CSV otherwise, union-find and heap events need -DMST_PROFILE)\n"
+							"\t-u <int>\treplay the heap operations of Prim's algorithm and the union-find operations of Kruskal's algorithm on a grid and a random graph of -r rows and -c columns <int> times and print the time and cache misses per operation\n"
+							"\t-v\t\tprint more information\n"
+							"\t-w <file>\tconvert the graph file to the binary format and store it in <file>\n"
+							"\t-x <file>\twrite the maze to <file> as PBM image (correct number of rows and columns needed!)\n"
+							"\nThis program is distributed under the terms of the LGPLv3 license\n");
+			handle.help = true;
+			break;
+		case 'i':
+			// update the MST with the edge updates of a file
+			handle.updateFile = &argv[currentArgument + 1][0];
+			handle.update = true;
+			currentArgument++;
+			break;
+		case 'j':
+			// answer jobs from the standard input
+			handle.server = true;
+			break;
+		case 'm':
+			// print the resulting maze to console at the end
+			handle.maze = true;
+			break;
+		case 'n':
+			// create a new maze file
+			handle.create = true;
+			break;
+		case 'o':
+			// write the MST to a file
+			handle.outputFile = &argv[currentArgument + 1][0];
+			handle.output = true;
+			currentArgument++;
+			break;
+		case 'p':
+			// contract vertex blocks before the global algorithm
+			handle.partition = true;
+			break;
+		case 'r':
+			// set number of rows
+			handle.rows = atoi(&argv[currentArgument + 1][0]);
+			currentArgument++;
+			break;
+		case 's':
+			// set the seed for new maze files and generated graphs
+			handle.seed = strtoul(&argv[currentArgument + 1][0], NULL, 10);
+			currentArgument++;
+			break;
+		case 't':
+			// write the timings and counters to a file
+			handle.timingsFile = &argv[currentArgument + 1][0];
+			handle.timings = true;
+			currentArgument++;
+			break;
+		case 'u':
+			// microbenchmark the heaps and the union-find
+			handle.trials = atoi(&argv[currentArgument + 1][0]);
+			if (handle.trials < 1) {
+				fprintf(stderr, "Wrong number of trials: %s\n"
+						"-h for help\n", argv[currentArgument + 1]);
+				exit(EXIT_FAILURE);
+			}
+			handle.microbenchmark = true;
+			currentArgument++;
+			break;
+		case 'v':
+			// print more information
+			handle.verbose = true;
+			break;
+		case 'w':
+			// convert the graph file to the binary format
+			handle.binaryFile = &argv[currentArgument + 1][0];
+			handle.convert = true;
+			currentArgument++;
+			break;
+		case 'x':
+			// write the maze to an image file
+			handle.imageFile = &argv[currentArgument + 1][0];
+			handle.image = true;
+			currentArgument++;
+			break;
+		default:
+			fprintf(stderr, "Wrong parameter: %s\n"
+					"-h for help\n", argv[currentArgument]);
+			exit(EXIT_FAILURE);
+		}
+	}
+
+	return handle;
+}
+
+/*
+ * push a new element to the end of a binary heap, then bubble up
+ */
+void pushBinaryMinHeap(BinaryMinHeap* heap, const Integer vertex,
+		const Integer via, const Integer weight) {
+	if (heap->size == heap->alloced) {
+		// double the size if heap is full
+		heap->elements = (BinaryHeapElement*) realloc(heap->elements,
+				2 * heap->alloced * sizeof(BinaryHeapElement));
+		heap->alloced *= 2;
+	}
+
+	heap->elements[heap->size] = (BinaryHeapElement ) { .vertex = vertex, .via =
+					via, .weight = weight };
+	heap->positions[vertex] = heap->size;
+
+	heapifyBinaryMinHeap(heap, heap->size);
+
+	heap->size++;
+}
+
+/*
+ * add a new element to the bucket of its weight
+ */
+void pushBucketQueue(BucketQueue* queue, const Integer vertex,
+		const Integer via, const Integer weight) {
+	linkBucketQueue(queue, vertex, weight - queue->minimum);
+	queue->vias[vertex] = via;
+	queue->size++;
+}
+
+/*
+ * push a new element to the end of a d-ary heap, then bubble up
+ */
+void pushDaryMinHeap(DaryMinHeap* heap, const Integer vertex, const Integer via,
+		const Integer weight) {
+	heap->keys[heap->size] = weight;
+	heap->vertices[heap->size] = vertex;
+	heap->vias[heap->size] = via;
+	heap->size++;
+
+	heapifyDaryMinHeap(heap, heap->size - 1);
+}
+
+/*
+ * hand a pending reversal of the node down to its children
+ */
+void pushDynamicMst(DynamicMst* mst, const Integer node) {
+	if (mst->flipped[node]) {
+		Integer left = mst->children[2 * node];
+		mst->children[2 * node] = mst->children[2 * node + 1];
+		mst->children[2 * node + 1] = left;
+		for (int i = 0; i < 2; i++) {
+			Integer child = mst->children[2 * node + i];
+			if (child != UNSET_ELEMENT) {
+				mst->flipped[child] = !mst->flipped[child];
+			}
+		}
+		mst->flipped[node] = false;
+	}
+}
+
+/*
+ * add a new element
+ */
+void pushFibonacciMinHeap(FibonacciMinHeap* heap, const Integer vertex,
+		const Integer via, const Integer weight) {
+	if (heap->used == heap->alloced) {
+		// double the size if the slab is full, links stay valid as indices
+		heap->elements = (FibonacciHeapElement*) realloc(heap->elements,
+				2 * heap->alloced * sizeof(FibonacciHeapElement));
+		heap->alloced *= 2;
+		heap->degree = (Integer*) realloc(heap->degree,
+				(2 * log2(heap->alloced) + 2) * sizeof(Integer));
+	}
+
+	// take the next element of the slab
+	Integer element = heap->used++;
+	newFibonacciHeapElement(&heap->elements[element], vertex, via, weight,
+			element, element, UNSET_ELEMENT, UNSET_ELEMENT);
+	heap->positions[vertex] = element;
+
+	// insert as root element
+	insertFibonacciMinHeap(heap, element);
+	heap->size++;
+}
+
+/*
+ * counter based pseudo random number, the same seed and counter always give
+ * the same number independent of the generating process or thread
+ */
+uint64_t randomNumber(const uint64_t seed, const uint64_t counter) {
+	// splitmix64 finalizer
+	uint64_t z = seed * 0x9E3779B97F4A7C15ULL
+			+ (counter + 1) * 0xBF58476D1CE4E5B9ULL;
+	z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ULL;
+	z = (z ^ (z >> 27)) * 0x94D049BB133111EBULL;
+	return z ^ (z >> 31);
+}
+
+/*
+ * stop the cache miss counter and return the misses since it was started, -1
+ * without a counter
+ */
+long readCacheMissCounter(const int counter) {
+#ifdef __linux__
+	long long misses;
+	if (counter >= 0 && ioctl(counter, PERF_EVENT_IOC_DISABLE, 0) == 0
+			&& read(counter, &misses, sizeof(misses)) == sizeof(misses)) {
+		return misses;
+	}
+#endif
+	return -1;
+}
+
+/*
+ * read a previously generated maze file and store it in the graph, returns
+ * false if the file can't be read
+ */
+bool readGraphFile(WeightedGraph* graph, const char inputFileName[]) {
+	// open the file
+	int inputFile = open(inputFileName, O_RDONLY);
+	if (inputFile == -1) {
+		fprintf(stderr, "Couldn't open input file!\n");
+		return false;
+	}
+
+	// binary graph files are mapped instead of parsed
+	char magic[sizeof(BINARY_MAGIC)];
+	if (pread(inputFile, magic, sizeof(magic), 0) == sizeof(magic)
+			&& memcmp(magic, BINARY_MAGIC, sizeof(magic)) == 0) {
+		close(inputFile);
+		return mapGraphFile(graph, inputFileName);
+	}
+
+	// text files are mapped read only and parsed in parallel
+	struct stat fileStatus;
+	char* text = MAP_FAILED;
+	if (fstat(inputFile, &fileStatus) != -1 && fileStatus.st_size > 0) {
+		text = (char*) mmap(NULL, fileStatus.st_size, PROT_READ, MAP_PRIVATE,
+				inputFile, 0);
+	}
+	close(inputFile);
+	if (text == MAP_FAILED) {
+		fprintf(stderr, "Something went wrong during reading of graph file!\n");
+		return false;
+	}
+	const char* end = text + fileStatus.st_size;
+
+	// first line contains number of vertices and edges
+	const char* position = text;
+	Integer vertices = 0;
+	Integer edges = 0;
+	if (!parseInteger(&position, end, &vertices)
+			|| !parseInteger(&position, end, &edges) || vertices < 0
+			|| edges < 0) {
+		fprintf(stderr, "Malformed graph file header!\n");
+		munmap(text, fileStatus.st_size);
+		return false;
+	}
+	newWeightedGraph(graph, vertices, edges);
+
+	// split all lines after the first into chunks starting at a line break
+	long bodySize = end - position;
+	int chunks = availableThreads() * 4;
+	if (chunks > bodySize / PARSE_CHUNK_SIZE + 1) {
+		chunks = bodySize / PARSE_CHUNK_SIZE + 1;
+	}
+	const char** chunkStart = (const char**) malloc(
+			(chunks + 1) * sizeof(const char*));
+	chunkStart[0] = position;
+	for (int i = 1; i < chunks; i++) {
+		const char* start = position + bodySize * i / chunks;
+		if (start < chunkStart[i - 1]) {
+			start = chunkStart[i - 1];
+		}
+		const char* lineBreak = (const char*) memchr(start, '\n', end - start);
+		chunkStart[i] = lineBreak == NULL ? end : lineBreak + 1;
+	}
+	chunkStart[chunks] = end;
+
+	// the edges of each chunk are stored behind the edges of all prior chunks
+	Integer* firstEdge = (Integer*) malloc((chunks + 1) * sizeof(Integer));
+	firstEdge[0] = 0;
+#pragma omp parallel for schedule(dynamic)
+	for (int i = 0; i < chunks; i++) {
+		firstEdge[i + 1] = countLines(chunkStart[i], chunkStart[i + 1]);
+	}
+	for (int i = 0; i < chunks; i++) {
+		firstEdge[i + 1] += firstEdge[i];
+	}
+
+	// all lines after the first contain the edges
+	// values stored as "from to weight"
+	bool malformed = firstEdge[chunks] < edges;
+#pragma omp parallel for schedule(dynamic) reduction(||:malformed)
+	for (int i = 0; i < chunks; i++) {
+		malformed = !parseEdges(chunkStart[i], chunkStart[i + 1], graph,
+				firstEdge[i]) || malformed;
+	}
+
+	// clean up
+	free(chunkStart);
+	free(firstEdge);
+	munmap(text, fileStatus.st_size);
+
+	if (malformed) {
+		fprintf(stderr, "Something went wrong during reading of graph file!\n");
+		deleteWeightedGraph(graph);
+		return false;
+	}
+	return true;
+}
+
+/*
+ * read the part of a binary graph file belonging to this process, binary is
+ * false if the file isn't in the binary format and nothing was read, returns
+ * false on all processes if the file can't be read
+ */
+bool readGraphFilePart(WeightedGraph* graph, const char inputFileName[],
+		bool* binary) {
+	int rank;
+	int size;
+	MPI_Comm_rank(MPI_COMM_GRAPH, &rank);
+	MPI_Comm_size(MPI_COMM_GRAPH, &size);
+	*binary = false;
+
+	// open the file
+	MPI_File inputFile;
+	if (MPI_File_open(MPI_COMM_GRAPH, inputFileName, MPI_MODE_RDONLY,
+	MPI_INFO_NULL, &inputFile) != MPI_SUCCESS) {
+		if (rank == 0) {
+			fprintf(stderr, "Couldn't open input file!\n");
+		}
+		return false;
+	}
+
+	// header contains number of vertices and edges
+	GraphFileHeader header;
+	memset(&header, 0, sizeof(GraphFileHeader));
+	MPI_File_read_at_all(inputFile, 0, &header, sizeof(GraphFileHeader),
+	MPI_BYTE, MPI_STATUS_IGNORE);
+	if (memcmp(header.magic, BINARY_MAGIC, sizeof(BINARY_MAGIC)) != 0) {
+		// text files are read by the first process only
+		MPI_File_close(&inputFile);
+		return true;
+	}
+	*binary = true;
+
+	// the size of the edges must not overflow for huge edge counts
+	MPI_Offset fileSize;
+	MPI_File_get_size(inputFile, &fileSize);
+	uint64_t maximumEdges = (INT64_MAX - sizeof(GraphFileHeader))
+			/ sizeof(Edge);
+	if (header.memberSize != sizeof(Integer)
+			|| header.weightSize != sizeof(Weight) || header.vertices < 0
+			|| header.edges < 0 || (uint64_t) header.edges > maximumEdges
+			|| fileSize < (MPI_Offset) (sizeof(GraphFileHeader)
+					+ (uint64_t) header.edges * sizeof(Edge))) {
+		if (rank == 0) {
+			fprintf(stderr, "Malformed binary graph file!\n");
+		}
+		MPI_File_close(&inputFile);
+		return false;
+	}
+
+	// each process reads a contiguous slice of the edges
+	Integer start;
+	Integer edgesPart;
+	partitionRange(header.edges, rank, size, &start, &edgesPart);
+	newWeightedGraph(graph, header.vertices, edgesPart);
+	graph->partitioned = true;
+	MPI_Offset offset = sizeof(GraphFileHeader)
+			+ (MPI_Offset) start * sizeof(Edge);
+	MPI_Status status;
+	int edgesRead = 0;
+	MPI_File_read_at_all(inputFile, offset, graph->edgeList, edgesPart,
+			MPI_GRAPH_EDGE, &status);
+	MPI_Get_count(&status, MPI_GRAPH_EDGE, &edgesRead);
+	MPI_File_close(&inputFile);
+
+	// every process checks its slice, so all of them agree on the error
+	bool malformed = edgesRead != edgesPart
+			|| !validEdges(graph->edgeList, edgesPart, header.vertices);
+	MPI_Allreduce(MPI_IN_PLACE, &malformed, 1, MPI_C_BOOL, MPI_LOR,
+			MPI_COMM_GRAPH);
+	if (malformed) {
+		if (rank == 0) {
+			fprintf(stderr, "Malformed binary graph file!\n");
+		}
+		deleteWeightedGraph(graph);
+		return false;
+	}
+
+	return true;
+}
+
+/*
+ * read the next job "graph file [algorithm]" from the standard input into the
+ * handle, lines with an unreadable graph file or an unknown algorithm are
+ * reported and skipped, returns false at the end of the input
+ */
+bool readJob(Handle* job, char** line, size_t* lineSize) {
+	const int defaultAlgorithm = job->algorithm;
+	while (getline(line, lineSize, stdin) != -1) {
+		char* graphFile = strtok(*line, " \t\r\n");
+		if (graphFile == NULL) {
+			// skip empty lines
+			continue;
+		}
+		char* algorithm = strtok(NULL, " \t\r\n");
+		char* end = NULL;
+		int chosen = algorithm == NULL ?
+				defaultAlgorithm : (int) strtol(algorithm, &end, 10);
+
+		if ((algorithm != NULL && *end != '\0')
+				|| strtok(NULL, " \t\r\n") != NULL || chosen < 0
+				|| chosen >= ALGORITHMS) {
+			fprintf(stderr, "Wrong job: %s\n", graphFile);
+		} else if (access(graphFile, R_OK) != 0) {
+			fprintf(stderr, "Couldn't open graph file of job: %s\n", graphFile);
+		} else {
+			job->algorithm = chosen;
+			job->graphFile = graphFile;
+			return true;
+		}
+	}
+
+	return false;
+}
+
+/*
+ * record the endpoints of the edges Kruskal's algorithm checks in order until
+ * the spanning forest is complete, returns the number of checked edges, the
+ * trace needs room for the endpoints of all edges
+ */
+Integer recordKruskalTrace(const WeightedGraph* graph, Integer* trace) {
+	// sort a copy, the graph stays as it is
+	Edge* edgeList = (Edge*) malloc((size_t) graph->edges * sizeof(Edge));
+	memcpy(edgeList, graph->edgeList, (size_t) graph->edges * sizeof(Edge));
+	sortEdgeList(edgeList, graph->edges);
+
+	Set* set = &(Set ) { .elements = 0, .parents = NULL };
+	newSet(set, graph->vertices);
+
+	Integer components = graph->vertices;
+	Integer checked = 0;
+	for (; checked < graph->edges && components > 1; checked++) {
+		Integer from = edgeList[checked].from;
+		Integer to = edgeList[checked].to;
+		trace[2 * checked] = from;
+		trace[2 * checked + 1] = to;
+
+		Integer canonicalElementFrom = findSet(set, from);
+		Integer canonicalElementTo = findSet(set, to);
+		if (canonicalElementFrom != canonicalElementTo) {
+			unionSet(set, canonicalElementFrom, canonicalElementTo);
+			components--;
+		}
+	}
+
+	// clean up
+	deleteSet(set);
+	free(edgeList);
+
+	return checked;
+}
+
+/*
+ * record the heap operations of Prim's algorithm with a binary heap, returns
+ * their number, the trace needs room for two operations per vertex and edge
+ */
+Integer recordPrimTrace(const WeightedGraph* graph, HeapOperation* trace) {
+	// create needed data structures
+	AdjacencyList* list = &(AdjacencyList ) { .elements = 0, .offsets =
+			NULL, .neighbors = NULL };
+	newAdjacencyList(list, graph);
+
+	BinaryMinHeap* heap = &(BinaryMinHeap ) { .alloced = 0, .size = 0,
+					.positions = NULL, .elements = NULL };
+	newBinaryMinHeap(heap, graph->vertices);
+	uint64_t* inTree = (uint64_t*) calloc(((size_t) graph->vertices + 63) / 64,
+			sizeof(uint64_t));
+
+	Integer vertex;
+	Integer via;
+	Integer weight;
+	Integer operations = 0;
+	for (Integer start = 0; start < graph->vertices; start++) {
+		if (getBit(inTree, start)) {
+			continue;
+		}
+
+		trace[operations++] = (HeapOperation ) { .type = PUSH_OPERATION,
+						.vertex = start, .via = UNSET_ELEMENT, .weight = 0 };
+		pushBinaryMinHeap(heap, start, UNSET_ELEMENT, 0);
+		while (heap->size > 0) {
+			trace[operations++] = (HeapOperation ) { .type = POP_OPERATION,
+							.vertex = UNSET_ELEMENT, .via = UNSET_ELEMENT,
+							.weight = 0 };
+			popBinaryMinHeap(heap, &vertex, &via, &weight);
+			setBit(inTree, vertex);
+
+			for (Integer i = list->offsets[vertex];
+					i < list->offsets[vertex + 1];
+					i++) {
+				if (!getBit(inTree, list->neighbors[i].vertex)) {
+					trace[operations++] = (HeapOperation ) { .type =
+									DECREASE_OPERATION, .vertex =
+									list->neighbors[i].vertex, .via = vertex,
+									.weight = list->neighbors[i].weight };
+					decreaseBinaryMinHeap(heap, list->neighbors[i].vertex, vertex,
+							list->neighbors[i].weight);
+				}
+			}
+		}
+	}
+
+	// clean up
+	deleteAdjacencyList(list);
+	deleteBinaryMinHeap(heap);
+	free(inTree);
+
+	return operations;
+}
+
+/*
+ * drop the contracted edges inside a component and keep only the lightest edge
+ * between two components, return the number of remaining edges
+ */
+Integer reduceContractedEdges(ContractedEdge* edgeList, const Integer edges) {
+	// the smaller component comes first
+	Integer kept = 0;
+	for (Integer i = 0; i < edges; i++) {
+		Integer from = edgeList[i].from;
+		Integer to = edgeList[i].to;
+		if (from != to) {
+			ContractedEdge* keptEdge = &edgeList[kept];
+			keptEdge->edge = edgeList[i].edge;
+			keptEdge->from = from < to ? from : to;
+			keptEdge->to = from < to ? to : from;
+			kept++;
+		}
+	}
+
+	// the lightest edge between two components is sorted first
+	qsort(edgeList, kept, sizeof(ContractedEdge), compareContractedEdges);
+	Integer reduced = 0;
+	for (Integer i = 0; i < kept; i++) {
+		if (reduced == 0 || edgeList[i].from != edgeList[reduced - 1].from
+				|| edgeList[i].to != edgeList[reduced - 1].to) {
+			edgeList[reduced++] = edgeList[i];
+		}
+	}
+
+	return reduced;
+}
+
+/*
+ * recompute the heaviest edge of the splay tree below the node
+ */
+void refreshDynamicMst(DynamicMst* mst, const Integer node) {
+	Integer heaviest = node < mst->vertices ? UNSET_ELEMENT : node;
+	for (int i = 0; i < 2; i++) {
+		Integer child = mst->children[2 * node + i];
+		if (child == UNSET_ELEMENT || mst->heaviest[child] == UNSET_ELEMENT) {
+			continue;
+		}
+		if (heaviest == UNSET_ELEMENT
+				|| mst->edgeList[mst->heaviest[child] - mst->vertices].weight
+						> mst->edgeList[heaviest - mst->vertices].weight) {
+			heaviest = mst->heaviest[child];
+		}
+	}
+	mst->heaviest[node] = heaviest;
+}
+
+/*
+ * delete the edge between two vertices, a tree edge is replaced by the
+ * lightest edge across the cut if there is one
+ */
+void removeDynamicMst(DynamicMst* mst, const Integer from, const Integer to) {
+	Integer edge = findDynamicEdge(mst, from, to);
+	if (edge == UNSET_ELEMENT) {
+		return;
+	}
+	logDynamicEdge(mst, edge);
+
+	bool inTree = getBit(mst->inTree, edge);
+	if (inTree) {
+		cutDynamicMst(mst, edge);
+	}
+
+	// the edge is only reused after the batch
+	unlinkIncidence(mst, 2 * edge, mst->edgeList[edge].from);
+	unlinkIncidence(mst, 2 * edge + 1, mst->edgeList[edge].to);
+	mst->edgeList[edge].from = UNSET_ELEMENT;
+
+	if (inTree) {
+		replaceDynamicMst(mst, from, to);
+	}
+}
+
+/*
+ * reconnect the trees of two vertices after their tree edge was cut with the
+ * lightest edge between them, both trees are searched in turns until the
+ * smaller one is complete, so only its edges are scanned
+ */
+void replaceDynamicMst(DynamicMst* mst, const Integer from, const Integer to) {
+	Integer* queues[2] = { mst->queue, &mst->queue[mst->vertices] };
+	Integer heads[2] = { 0, 0 };
+	Integer tails[2] = { 1, 1 };
+	queues[0][0] = from;
+	queues[1][0] = to;
+	mst->labels[from] = 0;
+	mst->labels[to] = 1;
+
+	int side = 0;
+	while (heads[side] < tails[side]) {
+		// visit the tree neighbors of the next vertex of this side
+		Integer vertex = queues[side][heads[side]++];
+		for (Integer i = mst->heads[vertex]; i != UNSET_ELEMENT;
+				i = mst->next[i]) {
+			Integer neighbor = neighborDynamicMst(mst, i);
+			if (getBit(mst->inTree, i / 2)
+					&& mst->labels[neighbor] == UNSET_ELEMENT) {
+				mst->labels[neighbor] = side;
+				queues[side][tails[side]++] = neighbor;
+			}
+		}
+		side = 1 - side;
+	}
+
+	// the edges leaving the complete side cross the cut
+	Integer lightest = UNSET_ELEMENT;
+	for (Integer j = 0; j < tails[side]; j++) {
+		for (Integer i = mst->heads[queues[side][j]]; i != UNSET_ELEMENT;
+				i = mst->next[i]) {
+			Integer edge = i / 2;
+			Integer neighbor = neighborDynamicMst(mst, i);
+			if (mst->labels[neighbor] != side && (lightest == UNSET_ELEMENT
+					|| mst->edgeList[edge].weight
+							< mst->edgeList[lightest].weight)) {
+				lightest = edge;
+			}
+		}
+	}
+
+	// clean up
+	for (int i = 0; i < 2; i++) {
+		for (Integer j = 0; j < tails[i]; j++) {
+			mst->labels[queues[i][j]] = UNSET_ELEMENT;
+		}
+	}
+
+	if (lightest != UNSET_ELEMENT) {
+		logDynamicEdge(mst, lightest);
+		linkDynamicMst(mst, lightest);
+	}
+}
+
+/*
+ * replay the heap operations of a trace on a new heap of a kind (BINARY_HEAP,
+ * FIBONACCI_HEAP, DARY_HEAP or BUCKET_QUEUE), store the time and the cache
+ * misses (-1 without a counter), returns false if the bucket queue would need
+ * too many buckets for the weights, every kind may pop other vertices of the
+ * same weight than the binary heap did, so pushes go through the decrease
+ * which also works for vertices still in the heap
+ */
+bool replayHeapTrace(const HeapOperation* trace, const Integer operations,
+		const Integer vertices, const int structure, const int arity,
+		const int counter, double* time, double* misses) {
+	Integer vertex;
+	Integer via;
+	Integer weight;
+	double start;
+
+	if (structure == BINARY_HEAP) {
+		BinaryMinHeap* heap = &(BinaryMinHeap ) { .alloced = 0, .size = 0,
+						.positions = NULL, .elements = NULL };
+		newBinaryMinHeap(heap, vertices);
+		startCacheMissCounter(counter);
+		start = MPI_Wtime();
+		for (Integer i = 0; i < operations; i++) {
+			if (trace[i].type == POP_OPERATION) {
+				popBinaryMinHeap(heap, &vertex, &via, &weight);
 			} else {
-				minimum->child = child->right;
-				child->right->left = child->left;
-				child->left->right = child->right;
-			}
-			child->parent = NULL;
-			child->right = minimum;
-			child->left = minimum->left;
-			minimum->left->right = child;
-			minimum->left = child;
+				decreaseBinaryMinHeap(heap, trace[i].vertex, trace[i].via,
+						trace[i].weight);
+			}
+		}
+		*time = MPI_Wtime() - start;
+		*misses = readCacheMissCounter(counter);
+		deleteBinaryMinHeap(heap);
+	} else if (structure == FIBONACCI_HEAP) {
+		FibonacciMinHeap* heap = &(FibonacciMinHeap ) { .alloced = 0, .size =
+				0, .used = 0, .minimum = UNSET_ELEMENT, .degree = NULL,
+				.positions = NULL, .elements = NULL };
+		newFibonacciMinHeap(heap, vertices);
+		startCacheMissCounter(counter);
+		start = MPI_Wtime();
+		for (Integer i = 0; i < operations; i++) {
+			if (trace[i].type == POP_OPERATION) {
+				popFibonacciMinHeap(heap, &vertex, &via, &weight);
+			} else {
+				decreaseFibonacciMinHeap(heap, trace[i].vertex, trace[i].via,
+						trace[i].weight);
+			}
+		}
+		*time = MPI_Wtime() - start;
+		*misses = readCacheMissCounter(counter);
+		deleteFibonacciMinHeap(heap);
+	} else if (structure == DARY_HEAP) {
+		DaryMinHeap* heap = &(DaryMinHeap ) { .alloced = 0, .arity = 0, .size =
+				0, .keys = NULL, .vertices = NULL, .vias = NULL, .positions =
+				NULL };
+		newDaryMinHeap(heap, arity, vertices);
+		startCacheMissCounter(counter);
+		start = MPI_Wtime();
+		for (Integer i = 0; i < operations; i++) {
+			if (trace[i].type == POP_OPERATION) {
+				popDaryMinHeap(heap, &vertex, &via, &weight);
+			} else {
+				decreaseDaryMinHeap(heap, trace[i].vertex, trace[i].via,
+						trace[i].weight);
+			}
+		}
+		*time = MPI_Wtime() - start;
+		*misses = readCacheMissCounter(counter);
+		deleteDaryMinHeap(heap);
+	} else {
+		// find the range of the weights
+		Integer minimum = 0;
+		Integer maximum = 0;
+		for (Integer i = 0; i < operations; i++) {
+			if (trace[i].type != POP_OPERATION) {
+				minimum = trace[i].weight < minimum ? trace[i].weight : minimum;
+				maximum = trace[i].weight > maximum ? trace[i].weight : maximum;
+			}
+		}
+		if ((uint64_t) maximum - (uint64_t) minimum
+				>= (uint64_t) BUCKET_QUEUE_RANGE) {
+			return false;
 		}
 
-		// remove minimum
-		if (minimum == minimum->right) {
-			heap->minimum = NULL;
-		} else {
-			minimum->right->left = minimum->left;
-			minimum->left->right = minimum->right;
-			heap->minimum = minimum->right;
+		BucketQueue* queue = &(BucketQueue ) { .minimum = 0, .range = 0,
+				.current = 0, .size = 0, .buckets = NULL, .next = NULL,
+				.previous = NULL, .keys = NULL, .vias = NULL };
+		newBucketQueue(queue, vertices, minimum, maximum - minimum + 1);
+		startCacheMissCounter(counter);
+		start = MPI_Wtime();
+		for (Integer i = 0; i < operations; i++) {
+			if (trace[i].type == POP_OPERATION) {
+				popBucketQueue(queue, &vertex, &via, &weight);
+			} else {
+				decreaseBucketQueue(queue, trace[i].vertex, trace[i].via,
+						trace[i].weight);
+			}
+		}
+		*time = MPI_Wtime() - start;
+		*misses = readCacheMissCounter(counter);
+		deleteBucketQueue(queue);
+	}
+
+	return true;
+}
+
+/*
+ * replay the finds and unions of the edges of a trace of Kruskal's algorithm
+ * on a new set, store the time and the cache misses (-1 without a counter)
+ */
+void replaySetTrace(const Integer* trace, const Integer edges,
+		const Integer vertices, const int counter, double* time,
+		double* misses) {
+	Set* set = &(Set ) { .elements = 0, .parents = NULL };
+	newSet(set, vertices);
+
+	startCacheMissCounter(counter);
+	double start = MPI_Wtime();
+	for (Integer i = 0; i < edges; i++) {
+		Integer canonicalElementFrom = findSet(set, trace[2 * i]);
+		Integer canonicalElementTo = findSet(set, trace[2 * i + 1]);
+		if (canonicalElementFrom != canonicalElementTo) {
+			unionSet(set, canonicalElementFrom, canonicalElementTo);
+		}
+	}
+	*time = MPI_Wtime() - start;
+	*misses = readCacheMissCounter(counter);
+
+	// clean up
+	deleteSet(set);
+}
+
+/*
+ * rotate the node above its parent in their splay tree
+ */
+void rotateDynamicMst(DynamicMst* mst, const Integer node) {
+	Integer parent = mst->parents[node];
+	Integer grandparent = mst->parents[parent];
+	int side = mst->children[2 * parent + 1] == node;
+	Integer inner = mst->children[2 * node + 1 - side];
+
+	// a path parent doesn't know the splay tree below it as a child
+	if (!isSplayRootDynamicMst(mst, parent)) {
+		mst->children[2 * grandparent
+				+ (mst->children[2 * grandparent + 1] == parent)] = node;
+	}
+	mst->parents[node] = grandparent;
+	mst->children[2 * node + 1 - side] = parent;
+	mst->parents[parent] = node;
+	mst->children[2 * parent + side] = inner;
+	if (inner != UNSET_ELEMENT) {
+		mst->parents[inner] = parent;
+	}
+
+	refreshDynamicMst(mst, parent);
+	refreshDynamicMst(mst, node);
+}
+
+/*
+ * find a MST of the graph with the algorithm of the handle, false for an
+ * unknown algorithm
+ */
+bool runAlgorithm(const Handle* handle, WeightedGraph* graph,
+		WeightedGraph* mst, Scratch* scratch) {
+	if (handle->partition && partitionedAlgorithm(handle->algorithm)) {
+		// only the block forests and the edges between blocks remain
+		partitionGraph(graph);
+	}
+	switch (handle->algorithm) {
+	case 0:
+		// use Kruskal's algorithm
+		mstKruskal(graph, mst, scratch);
+		break;
+	case 1:
+		// use Prim's algorithm (fibonacci)
+		mstPrimFibonacci(graph, mst, scratch);
+		break;
+	case 2:
+		// use Prim's algorithm (binary)
+		mstPrimBinary(graph, mst, scratch);
+		break;
+	case 3:
+		// use Boruvka's algorithm
+		mstBoruvka(graph, mst, scratch);
+		break;
+	case 4:
+		// use Filter-Kruskal
+		mstFilterKruskal(graph, mst, scratch);
+		break;
+	case 5:
+		// use Prim's algorithm (d-ary)
+		mstPrimDary(graph, mst, handle->arity);
+		break;
+	case 6:
+		// use Prim's algorithm (bucket queue)
+		mstPrimBucket(graph, mst, scratch);
+		break;
+	case 7:
+		// use Boruvka's algorithm with distributed vertices
+		mstBoruvkaDistributed(graph, mst);
+		break;
+	default:
+		return false;
+	}
+	return true;
+}
+
+/*
+ * sort a partitioned graph with sample sort, afterwards each process holds a
+ * sorted weight range and all ranges are ordered by process
+ */
+void sampleSort(WeightedGraph* graph) {
+	int rank;
+	int size;
+	MPI_Comm_rank(MPI_COMM_GRAPH, &rank);
+	MPI_Comm_size(MPI_COMM_GRAPH, &size);
+
+	// sort the part, the stable sort keeps equal weights in position order so
+	// (weight, process, position) is a unique key of every edge, both sorts
+	// lap the sort phase themselves, the exchange counts as scatter phase
+	sortEdgeList(graph->edgeList, graph->edges);
+	double lap = MPI_Wtime();
+
+	// regular samples of the sorted part
+	int samplesPart = graph->edges < size ? graph->edges : size;
+	Sample* samplesPartList = (Sample*) malloc(
+			(samplesPart > 0 ? samplesPart : 1) * sizeof(Sample));
+	for (int i = 0; i < samplesPart; i++) {
+		Integer position = (2 * i + 1) * (long) graph->edges
+				/ (2 * samplesPart);
+		samplesPartList[i] = (Sample ) { .process = rank, .position =
+						position, .weight = graph->edgeList[position].weight };
+	}
+
+	// every process chooses the same splitters from all samples
+	MPI_Datatype MPI_SAMPLE = newRecordType(2, offsetof(Sample, weight),
+			MPI_GRAPH_WEIGHT, sizeof(Sample));
+	int* counts = (int*) malloc(size * sizeof(int));
+	int* offsets = (int*) malloc(size * sizeof(int));
+	MPI_Allgather(&samplesPart, 1, MPI_INT, counts, 1, MPI_INT,
+			MPI_COMM_GRAPH);
+	countSentBytes(1, MPI_INT);
+	int samples = 0;
+	for (int i = 0; i < size; i++) {
+		offsets[i] = samples;
+		samples += counts[i];
+	}
+	Sample* sampleList = (Sample*) malloc(
+			(samples > 0 ? samples : 1) * sizeof(Sample));
+	MPI_Allgatherv(samplesPartList, samplesPart, MPI_SAMPLE, sampleList,
+			counts, offsets, MPI_SAMPLE, MPI_COMM_GRAPH);
+	countSentBytes(samplesPart, MPI_SAMPLE);
+	qsort(sampleList, samples, sizeof(Sample), compareSamples);
+
+	// process i recieves all edges between splitter i - 1 and splitter i
+	int* sendCounts = (int*) malloc(size * sizeof(int));
+	int* sendOffsets = (int*) malloc(size * sizeof(int));
+	Integer boundary = 0;
+	for (int i = 0; i < size; i++) {
+		Integer nextBoundary = graph->edges;
+		if (i < size - 1 && samples > 0) {
+			// binary search for the first edge not below the splitter
+			const Sample* splitter = &sampleList[(i + 1) * samples / size];
+			Integer low = boundary;
+			Integer high = graph->edges;
+			while (low < high) {
+				Integer middle = low + (high - low) / 2;
+				Sample key = { .process = rank, .position = middle, .weight =
+						graph->edgeList[middle].weight };
+				if (compareSamples(&key, splitter) < 0) {
+					low = middle + 1;
+				} else {
+					high = middle;
+				}
+			}
+			nextBoundary = low;
+		}
+		sendOffsets[i] = boundary;
+		sendCounts[i] = nextBoundary - boundary;
+		boundary = nextBoundary;
+	}
+
+	// exchange the edges
+	MPI_Alltoall(sendCounts, 1, MPI_INT, counts, 1, MPI_INT, MPI_COMM_GRAPH);
+	countSentBytes(size, MPI_INT);
+	Integer edgesPart = 0;
+	for (int i = 0; i < size; i++) {
+		offsets[i] = edgesPart;
+		edgesPart += counts[i];
+	}
+	WeightedGraph part;
+	newWeightedGraph(&part, graph->vertices, edgesPart);
+	part.partitioned = true;
+	MPI_Alltoallv(graph->edgeList, sendCounts, sendOffsets, MPI_GRAPH_EDGE,
+			part.edgeList, counts, offsets, MPI_GRAPH_EDGE, MPI_COMM_GRAPH);
+	countSentBytes(sumCounts(sendCounts, size), MPI_GRAPH_EDGE);
+	lapPhase(SCATTER_PHASE, &lap);
+
+	// sort the recieved runs
+	sortEdgeList(part.edgeList, part.edges);
+
+	// clean up
+	deleteWeightedGraph(graph);
+	*graph = part;
+	free(samplesPartList);
+	free(sampleList);
+	free(counts);
+	free(offsets);
+	free(sendCounts);
+	free(sendOffsets);
+	MPI_Type_free(&MPI_SAMPLE);
+}
+
+/*
+ * join the vertices in the set which the weight ranges of the processes before
+ * this one connect, the spanning forests of the ranges are passed on in a
+ * prefix scan of log(processes) steps, so no process recieves more than a
+ * spanning forest per step and the first process gets nothing
+ */
+void scanSpanningForests(const WeightedGraph* graph, Set* set) {
+	int rank;
+	int size;
+	MPI_Comm_rank(MPI_COMM_GRAPH, &rank);
+	MPI_Comm_size(MPI_COMM_GRAPH, &size);
+	MPI_Status status;
+	double lap = MPI_Wtime();
+
+	// the forest of the own range and the ranges recieved so far is passed on
+	Integer capacity = graph->vertices > 0 ? graph->vertices - 1 : 0;
+	WeightedGraph* forest = &(WeightedGraph ) { .partitioned = false, .edges =
+					0, .vertices = 0, .edgeList = NULL, .mappingSize = 0,
+					.mapping = NULL };
+	newWeightedGraph(forest, graph->vertices, capacity);
+	forest->edges = 0;
+	Set* forestSet = &(Set ) { .elements = 0, .parents = NULL };
+	newSet(forestSet, graph->vertices);
+	addSortedEdges(graph->edgeList, graph->edges, forestSet, forest,
+			&forest->edges);
+
+	memset(set->parents, UNSET_ELEMENT, set->elements * sizeof(Integer));
+	Edge* recieveBuffer = (Edge*) malloc(
+			(capacity > 0 ? capacity : 1) * sizeof(Edge));
+	for (int step = 1; step < size; step *= 2) {
+		// after this step the forest spans the ranges of 2 * step processes
+		int to = rank + step < size ? rank + step : MPI_PROC_NULL;
+		int from = rank >= step ? rank - step : MPI_PROC_NULL;
+		int recieved;
+		MPI_Sendrecv(forest->edgeList, forest->edges, MPI_GRAPH_EDGE, to, 0,
+				recieveBuffer, capacity, MPI_GRAPH_EDGE, from, 0,
+				MPI_COMM_GRAPH, &status);
+		MPI_Get_count(&status, MPI_GRAPH_EDGE, &recieved);
+		if (to != MPI_PROC_NULL) {
+			countSentBytes(forest->edges, MPI_GRAPH_EDGE);
+		}
+
+		// only the connectivity of the recieved ranges matters
+		for (Integer i = 0; i < recieved; i++) {
+			Integer canonicalElementFrom = findSet(set,
+					recieveBuffer[i].from);
+			Integer canonicalElementTo = findSet(set, recieveBuffer[i].to);
+			if (canonicalElementFrom != canonicalElementTo) {
+				unionSet(set, canonicalElementFrom, canonicalElementTo);
+			}
+		}
+		addSortedEdges(recieveBuffer, recieved, forestSet, forest,
+				&forest->edges);
+	}
+
+	// clean up
+	deleteWeightedGraph(forest);
+	deleteSet(forestSet);
+	free(recieveBuffer);
+	lapPhase(MERGE_PHASE, &lap);
+}
+
+/*
+ * empty binary min heap of the scratch for the vertices smaller than
+ * elements, it's only allocated again if it has to grow
+ */
+BinaryMinHeap* scratchBinaryMinHeap(Scratch* scratch, const Integer elements) {
+	BinaryMinHeap* heap = &scratch->binaryHeap;
+	if (heap->positions == NULL || elements > scratch->binaryHeapElements) {
+		deleteBinaryMinHeap(heap);
+		newBinaryMinHeap(heap, elements);
+		scratch->binaryHeapElements = elements;
+	} else {
+		heap->size = 0;
+		memset(heap->positions, UNSET_ELEMENT, elements * sizeof(Integer));
+	}
+	return heap;
+}
+
+/*
+ * empty fibonacci min heap of the scratch for the vertices smaller than
+ * elements, it's only allocated again if it has to grow
+ */
+FibonacciMinHeap* scratchFibonacciMinHeap(Scratch* scratch,
+		const Integer elements) {
+	FibonacciMinHeap* heap = &scratch->fibonacciHeap;
+	if (heap->positions == NULL || elements > heap->alloced) {
+		deleteFibonacciMinHeap(heap);
+		newFibonacciMinHeap(heap, elements);
+	} else {
+		heap->size = 0;
+		heap->used = 0;
+		heap->minimum = UNSET_ELEMENT;
+		memset(heap->positions, UNSET_ELEMENT, elements * sizeof(Integer));
+	}
+	return heap;
+}
+
+/*
+ * set of the scratch with every element as a root of its own component, it's
+ * only allocated again if it has to grow
+ */
+Set* scratchSet(Scratch* scratch, const Integer elements) {
+	Set* set = &scratch->set;
+	if (set->parents == NULL || elements > scratch->setElements) {
+		deleteSet(set);
+		newSet(set, elements);
+		scratch->setElements = elements;
+	} else {
+		set->elements = elements;
+		memset(set->parents, UNSET_ELEMENT, elements * sizeof(Integer));
+	}
+	return set;
+}
+
+/*
+ * answer the jobs of the standard input of the first process until its end,
+ * the job descriptors are broadcast like the handle at the start, so the
+ * processes stay alive between the jobs, every job prints one result line, also
+ * if its graph file can't be read, the graph stays resident while the jobs ask
+ * for the same unchanged file and the MST buffer and the scratch only grow
+ * between the jobs
+ */
+void serveJobs(const Handle* handle, MPI_Datatype MPI_HANDLE) {
+	int rank;
+	MPI_Comm_rank(MPI_COMM_GRAPH, &rank);
+
+	WeightedGraph* graph = &(WeightedGraph ) { .partitioned = false, .edges =
+					0, .vertices = 0, .edgeList = NULL, .mappingSize = 0,
+					.mapping = NULL };
+	WeightedGraph* mst = &(WeightedGraph ) { .partitioned = false, .edges = 0,
+					.vertices = 0, .edgeList = NULL, .mappingSize = 0,
+					.mapping = NULL };
+	Integer mstAlloced = 0;
+	Scratch* scratch = &(Scratch ) { .setElements = 0, .binaryHeapElements =
+					0 };
+	char* residentFile = NULL;
+	struct stat residentStatus;
+	char* line = NULL;
+	size_t lineSize = 0;
+	for (long jobs = 1;; jobs++) {
+		Handle job = *handle;
+		if (rank == 0) {
+			job.server = readJob(&job, &line, &lineSize);
+		}
+		MPI_Bcast(&job, 1, MPI_HANDLE, 0, MPI_COMM_GRAPH);
+		if (!job.server) {
+			break;
+		}
+		broadcastString(&job.graphFile);
+
+		// Kruskal and Boruvka only need each process to hold its part of the
+		// edges
+		bool partitionedInput = partitionedAlgorithm(job.algorithm);
+
+		// the graph of the last job is kept if the file didn't change, the
+		// algorithms only reorder or reduce its edges, but one distributed by
+		// Kruskal or Boruvka isn't available to Prim any more
+		bool resident = residentFile != NULL
+				&& strcmp(residentFile, job.graphFile) == 0
+				&& (partitionedInput || !graph->partitioned);
+		if (rank == 0 && resident) {
+			struct stat fileStatus;
+			resident = stat(job.graphFile, &fileStatus) == 0
+					&& fileStatus.st_mtime == residentStatus.st_mtime
+					&& fileStatus.st_size == residentStatus.st_size;
+		}
+		MPI_Bcast(&resident, 1, MPI_C_BOOL, 0, MPI_COMM_GRAPH);
+		if (!resident) {
+			deleteWeightedGraph(graph);
+			*graph = (WeightedGraph ) { .partitioned = false, .edges = 0,
+							.vertices = 0, .edgeList = NULL, .mappingSize = 0,
+							.mapping = NULL };
+			free(residentFile);
+			residentFile = NULL;
+
+			if (partitionedInput) {
+				MPI_Barrier(MPI_COMM_GRAPH);
+			}
+			double lap = MPI_Wtime();
+			bool read = loadGraphFile(graph, job.graphFile, partitionedInput);
+			lapPhase(READ_PHASE, &lap);
+			if (rank == 0 && read) {
+				// the status tells if the file changed before the next job
+				read = stat(job.graphFile, &residentStatus) == 0;
+			}
+			MPI_Bcast(&read, 1, MPI_C_BOOL, 0, MPI_COMM_GRAPH);
+			if (!read) {
+				// all processes skip the job and wait for the next one
+				if (rank == 0) {
+					printf("Job %ld: %s, couldn't read the graph file\n", jobs,
+							job.graphFile);
+					fflush(stdout);
+				}
+				deleteWeightedGraph(graph);
+				*graph = (WeightedGraph ) { .partitioned = false, .edges = 0,
+								.vertices = 0, .edgeList = NULL,
+								.mappingSize = 0, .mapping = NULL };
+				if (rank != 0) {
+					free(job.graphFile);
+				}
+				continue;
+			}
+			residentFile = strdup(job.graphFile);
+		}
+
+		if (rank == 0) {
+			Integer edges = graph->vertices > 1 ? graph->vertices - 1 : 1;
+			if (edges > mstAlloced) {
+				mst->edgeList = (Edge*) realloc(mst->edgeList,
+						(size_t) edges * sizeof(Edge));
+				mstAlloced = edges;
+			}
+			mst->vertices = graph->vertices;
+			mst->edges = graph->vertices - 1;
+		}
+
+		double elapsed = profile.phases[ALGORITHM_PHASE];
+		double start = MPI_Wtime();
+		runAlgorithm(&job, graph, mst, scratch);
+		lapPhase(ALGORITHM_PHASE, &start);
+
+		if (rank == 0) {
+			if (job.verbose) {
+				// print the edges of the MST
+				printf("MST:\n");
+				printWeightedGraph(mst);
+			}
+
+			// the result is written before the next job is read
+			printf("Job %ld: %s, %s, MST weight: %lu, MST components: %"
+					INTEGER_FORMAT ", time: %f s\n", jobs, job.graphFile,
+					ALGORITHM_NAMES[job.algorithm], sumWeights(mst),
+					graph->vertices - mst->edges,
+					profile.phases[ALGORITHM_PHASE] - elapsed);
+			fflush(stdout);
+		}
+
+		// clean up
+		if (rank != 0) {
+			free(job.graphFile);
+		}
+	}
+
+	if (handle->timings) {
+		// reduce the timings and counters of all jobs
+		writeTimingsFile(handle->timingsFile);
+	}
+
+	// clean up
+	deleteWeightedGraph(graph);
+	deleteWeightedGraph(mst);
+	deleteScratch(scratch);
+	free(residentFile);
+	free(line);
+}
+
+/*
+ * set a bit of a bit array
+ */
+void setBit(uint64_t* bits, const Integer position) {
+	bits[position / 64] |= 1ULL << (position % 64);
+}
+
+/*
+ * sort the edge list by weight, bounded weights are sorted in linear time
+ * with a counting sort, all others with a radix sort of their keys
+ */
+void sortEdgeList(Edge* edgeList, const Integer elements) {
+	if (elements < 2) {
+		return;
+	}
+	double lap = MPI_Wtime();
+
+	// observed weight range
+	Weight minimum = WEIGHT_MAXIMUM;
+	Weight maximum = WEIGHT_MINIMUM;
+	for (Integer i = 0; i < elements; i++) {
+		Weight weight = edgeList[i].weight;
+		minimum = weight < minimum ? weight : minimum;
+		maximum = weight > maximum ? weight : maximum;
+	}
+
+	if ((uint64_t) maximum - (uint64_t) minimum
+			< (uint64_t) COUNTING_SORT_RANGE) {
+		countingSort(edgeList, elements, minimum, maximum - minimum + 1);
+	} else {
+		sortEdgeListByKey(edgeList, elements);
+	}
+	lapPhase(SORT_PHASE, &lap);
+}
+
+/*
+ * sort the edge list by weight through (weight, position) keys, the keys are
+ * radix sorted by their weight byte by byte and the edges are moved only once
+ * at the end
+ */
+void sortEdgeListByKey(Edge* edgeList, const Integer elements) {
+	uint64_t* keys = (uint64_t*) malloc(elements * sizeof(uint64_t));
+	uint64_t* keyBuffer = (uint64_t*) malloc(elements * sizeof(uint64_t));
+	Integer* positions = (Integer*) malloc(elements * sizeof(Integer));
+	Integer* positionBuffer = (Integer*) malloc(elements * sizeof(Integer));
+	const int weightBits = sizeof(Weight) * CHAR_BIT;
+	const uint64_t signBit = WEIGHT_MINIMUM < 0 ? 1ULL << (weightBits - 1) : 0;
+	for (Integer i = 0; i < elements; i++) {
+		// flipping the sign bit orders negative weights first
+		keys[i] = (uint64_t) edgeList[i].weight ^ signBit;
+		positions[i] = i;
+	}
+
+	// least significant byte of the weight first, each pass is stable
+	for (int shift = 0; shift < weightBits; shift += 8) {
+		Integer counts[257] = { 0 };
+		for (Integer i = 0; i < elements; i++) {
+			counts[((keys[i] >> shift) & 0xFF) + 1]++;
 		}
-		heap->size--;
-		heap->positions[minimum->vertex] = NULL;
-		free(minimum);
-		if (heap->size > 0) {
-			consolidateFibonacciMinHeap(heap);
+		if (counts[((keys[0] >> shift) & 0xFF) + 1] == elements) {
+			// all keys share this byte
+			continue;
+		}
+		for (int i = 0; i < 256; i++) {
+			counts[i + 1] += counts[i];
 		}
+		for (Integer i = 0; i < elements; i++) {
+			Integer position = counts[(keys[i] >> shift) & 0xFF]++;
+			keyBuffer[position] = keys[i];
+			positionBuffer[position] = positions[i];
+		}
+		uint64_t* swapKeys = keys;
+		keys = keyBuffer;
+		keyBuffer = swapKeys;
+		Integer* swapPositions = positions;
+		positions = positionBuffer;
+		positionBuffer = swapPositions;
+	}
+
+	// move the edges to their sorted positions
+	Edge* working = (Edge*) malloc((size_t) elements * sizeof(Edge));
+	for (Integer i = 0; i < elements; i++) {
+		working[i] = edgeList[positions[i]];
 	}
+	memcpy(edgeList, working, (size_t) elements * sizeof(Edge));
+
+	// clean up
+	free(keys);
+	free(keyBuffer);
+	free(positions);
+	free(positionBuffer);
+	free(working);
 }
 
 /*
- * prints the adjacency list
+ * move the node to the root of its splay tree
  */
-void printAdjacencyList(const AdjacencyList* list) {
-	for (int i = 0; i < list->elements; i++) {
-		printf("%d:", i);
-		for (int j = 0; j < list->lists[i].size; j++) {
-			printf(" %d(%d)", list->lists[i].elements[j].vertex,
-					list->lists[i].elements[j].weight);
+void splayDynamicMst(DynamicMst* mst, const Integer node) {
+	// pending reversals above the node are handed down first
+	Integer depth = 0;
+	mst->stack[depth++] = node;
+	for (Integer i = node; !isSplayRootDynamicMst(mst, i); i = mst->parents[i]) {
+		mst->stack[depth++] = mst->parents[i];
+	}
+	while (depth > 0) {
+		pushDynamicMst(mst, mst->stack[--depth]);
+	}
+
+	while (!isSplayRootDynamicMst(mst, node)) {
+		Integer parent = mst->parents[node];
+		if (!isSplayRootDynamicMst(mst, parent)) {
+			Integer grandparent = mst->parents[parent];
+			bool straight = (mst->children[2 * parent] == node)
+					== (mst->children[2 * grandparent] == parent);
+			rotateDynamicMst(mst, straight ? parent : node);
 		}
-		printf("\n");
+		rotateDynamicMst(mst, node);
 	}
 }
 
 /*
- * print binary min heap
+ * reset and start the cache miss counter
  */
-void printBinaryHeap(const BinaryMinHeap* heap) {
-	for (int i = 0; i < heap->size; i++) {
-		printf("[%d]%d: %d(%d) ", heap->positions[heap->elements[i].vertex],
-				heap->elements[i].vertex, heap->elements[i].via,
-				heap->elements[i].weight);
-		if (log2(i + 2) == (int) log2(i + 2)) {
-			// line break after each stage
-			printf("\n");
-		}
+void startCacheMissCounter(const int counter) {
+#ifdef __linux__
+	if (counter >= 0) {
+		ioctl(counter, PERF_EVENT_IOC_RESET, 0);
+		ioctl(counter, PERF_EVENT_IOC_ENABLE, 0);
 	}
-	printf("\n");
+#endif
 }
 
 /*
- * print fibonacci min heap
+ * return the sum of the counts of a message to every process
  */
-void printFibonacciHeap(const FibonacciMinHeap* heap,
-		FibonacciHeapElement* startElement) {
-	if (heap->size > 0) {
-		FibonacciHeapElement* currentElement = startElement;
-		printf("[%d]:", startElement->vertex);
-		do {
-			printf(" (%d,%d)%d|%d|%d", currentElement->marked,
-					currentElement->childrens, currentElement->vertex,
-					currentElement->via, currentElement->weight);
-			currentElement = currentElement->right;
-		} while (currentElement != startElement);
-		printf("\n");
-		do {
-			if (currentElement->child != NULL) {
-				printf("{%d}", currentElement->vertex);
-				printFibonacciHeap(heap, currentElement->child);
-				printf("\n");
-			}
-			currentElement = currentElement->right;
-		} while (currentElement != startElement);
-	} else {
-		printf("heap is empty!\n");
+long sumCounts(const int* counts, const int size) {
+	long sum = 0;
+	for (int i = 0; i < size; i++) {
+		sum += counts[i];
 	}
+	return sum;
 }
 
 /*
- * print the graph as a maze to console
+ * return the sum of the weights of all edges
  */
-void printMaze(const WeightedGraph* graph, const int rows, const int columns) {
-	// initialize the maze with spaces
-	int rowsMaze = rows * 2 - 1;
-	int columnsMaze = columns * 2 - 1;
-	char maze[rowsMaze][columnsMaze];
-	memset(maze, EMPTY_FIELD, rowsMaze * columnsMaze * sizeof(char));
-
-	// each vertex is represented as a plus sign
-	for (int i = 0; i < rowsMaze; i++) {
-		for (int j = 0; j < columnsMaze; j++) {
-			if (i % 2 == 0 && j % 2 == 0) {
-				maze[i][j] = VERTEX;
-			}
-		}
+unsigned long sumWeights(const WeightedGraph* graph) {
+	unsigned long weight = 0;
+	for (Integer i = 0; i < graph->edges; i++) {
+		weight += graph->edgeList[i].weight;
 	}
+	return weight;
+}
 
-	// each edge is represented as dash or pipe sign
-	for (int i = 0; i < graph->edges; i++) {
-		int from;
-		int to;
-		if (graph->edgeList[i * EDGE_MEMBERS]
-				< graph->edgeList[i * EDGE_MEMBERS + 1]) {
-			from = graph->edgeList[i * EDGE_MEMBERS];
-			to = graph->edgeList[i * EDGE_MEMBERS + 1];
-		} else {
-			to = graph->edgeList[i * EDGE_MEMBERS];
-			from = graph->edgeList[i * EDGE_MEMBERS + 1];
-		}
-		int row = from / columns + to / columns;
-		if (row % 2) {
-			// edges in even rows are displayed as pipes
-			maze[row][(to % columns) * 2] = VERTICAL_EDGE;
-		} else {
-			// edges in uneven rows are displayed as dashes
-			maze[row][(to % columns - 1) * 2 + 1] = HORIZONTAL_EDGE;
-		}
-	}
+/*
+ * helper function to swap binary heap elements
+ */
+void swapBinaryHeapElement(BinaryMinHeap* heap, const Integer position1,
+		const Integer position2) {
+	heap->positions[heap->elements[position1].vertex] = position2;
+	heap->positions[heap->elements[position2].vertex] = position1;
 
-	// print the char array to the console
-	for (int i = 0; i < rowsMaze; i++) {
-		for (int j = 0; j < columnsMaze; j++) {
-			printf("%c", maze[i][j]);
-		}
-		printf("\n");
+	BinaryHeapElement swap = heap->elements[position1];
+	heap->elements[position1] = heap->elements[position2];
+	heap->elements[position2] = swap;
+}
+
+/*
+ * swap two edges
+ */
+void swapEdge(Edge* edge1, Edge* edge2) {
+	Edge swap = *edge1;
+	*edge1 = *edge2;
+	*edge2 = swap;
+}
+
+/*
+ * merge the set of parent1 and parent2 with union by rank
+ */
+void unionSet(Set* set, const Integer parent1, const Integer parent2) {
+	Integer root1 = findSet(set, parent1);
+	Integer root2 = findSet(set, parent2);
+
+	if (root1 == root2) {
+		return;
+	} else if (set->parents[root1] < set->parents[root2]) {
+		// the first component is larger
+		set->parents[root1] += set->parents[root2];
+		set->parents[root2] = root1;
+	} else {
+		set->parents[root2] += set->parents[root1];
+		set->parents[root1] = root2;
 	}
 }
 
 /*
- * print the components of the set
+ * remove a vertex from its bucket
  */
-void printSet(const Set* set) {
-	for (int i = 0; i < set->elements; i++) {
-		printf("%d: %d(%d)\n", i, set->canonicalElements[i], set->rank[i]);
+void unlinkBucketQueue(BucketQueue* queue, const Integer vertex) {
+	if (queue->previous[vertex] == UNSET_ELEMENT) {
+		queue->buckets[queue->keys[vertex]] = queue->next[vertex];
+	} else {
+		queue->next[queue->previous[vertex]] = queue->next[vertex];
+	}
+	if (queue->next[vertex] != UNSET_ELEMENT) {
+		queue->previous[queue->next[vertex]] = queue->previous[vertex];
 	}
 }
 
 /*
- * print all edges of the graph in "from to weight" format
+ * remove an incidence from the list of its vertex
  */
-void printWeightedGraph(const WeightedGraph* graph) {
-	for (int i = 0; i < graph->edges; i++) {
-		for (int j = 0; j < EDGE_MEMBERS; j++) {
-			printf("%d\t", graph->edgeList[i * EDGE_MEMBERS + j]);
-		}
-		printf("\n");
+void unlinkIncidence(DynamicMst* mst, const Integer incidence,
+		const Integer vertex) {
+	if (mst->previous[incidence] == UNSET_ELEMENT) {
+		mst->heads[vertex] = mst->next[incidence];
+	} else {
+		mst->next[mst->previous[incidence]] = mst->next[incidence];
+	}
+	if (mst->next[incidence] != UNSET_ELEMENT) {
+		mst->previous[mst->next[incidence]] = mst->previous[incidence];
 	}
 }
 
 /*
- * process the command line parameters and return a Handle struct with them
+ * insert an edge between two vertices or change its weight, lighter edges may
+ * replace the heaviest edge of their cycle and heavier tree edges the lightest
+ * edge across their cut
  */
-Handle processParameters(int argc, char* argv[]) {
-	Handle handle = { .algorithm = 0, .columns = 3, .help = false,
-			.maze = false, .create = false, .rows = 2, .verbose = false,
-			.graphFile = "maze.csv" };
+void updateDynamicMst(DynamicMst* mst, const Integer from, const Integer to,
+		const Weight weight) {
+	Integer edge = findDynamicEdge(mst, from, to);
+	if (edge == UNSET_ELEMENT) {
+		edge = addDynamicEdge(mst, from, to, weight);
+		logDynamicEdge(mst, edge);
+		insertDynamicMst(mst, edge);
+		return;
+	}
+	logDynamicEdge(mst, edge);
 
-	for (int currentArgument = 1; currentArgument < argc; currentArgument++) {
-		switch (argv[currentArgument][1]) {
-		case 'a':
-			// choose algorithm
-			handle.algorithm = atoi(&argv[currentArgument + 1][0]);
-			currentArgument++;
-			break;
-		case 'c':
-			// set number of columns
-			handle.columns = atoi(&argv[currentArgument + 1][0]);
-			currentArgument++;
-			break;
-		case 'f':
-			// set graph file location
-			handle.graphFile = &argv[currentArgument + 1][0];
-			currentArgument++;
-			break;
-		case 'h':
-			// print help message
-			printf(
-					"Parameters:\n"
-							"\t-a <int>\tchoose algorithm: 0 Kruskal (default), 1 Prim (Fibonacci), 2 Prim (Binary), 3 Boruvka\n"
-							"\t-c <int>\tset number of columns (default: 3)\n"
-							"\t-h\t\tprint this help message\n"
-							"\t-m\t\tprint the resulting maze to console at the end (correct number of rows and columns needed!)\n"
-							"\t-n\t\tcreate a new maze file\n"
-							"\t-r <int>\tset number of rows (default: 2)\n"
-							"\t-v\t\tprint more information\n"
-							"\nThis program is distributed under the terms of the LGPLv3 license\n");
-			handle.help = true;
-			break;
-		case 'm':
-			// print the resulting maze to console at the end
-			handle.maze = true;
-			break;
-		case 'n':
-			// create a new maze file
-			handle.create = true;
-			break;
-		case 'r':
-			// set number of rows
-			handle.rows = atoi(&argv[currentArgument + 1][0]);
-			currentArgument++;
-			break;
-		case 'v':
-			// print more information
-			handle.verbose = true;
-			break;
-		default:
-			fprintf(stderr, "Wrong parameter: %s\n"
-					"-h for help\n", argv[currentArgument]);
-			exit(EXIT_FAILURE);
+	Weight previous = mst->edgeList[edge].weight;
+	if (!getBit(mst->inTree, edge)) {
+		mst->edgeList[edge].weight = weight;
+		if (weight < previous) {
+			insertDynamicMst(mst, edge);
 		}
+	} else if (weight < previous) {
+		// the edge node is the root of its splay tree after the splay
+		Integer node = mst->vertices + edge;
+		splayDynamicMst(mst, node);
+		mst->edgeList[edge].weight = weight;
+		refreshDynamicMst(mst, node);
+		mst->weight -= previous - weight;
+	} else if (weight > previous) {
+		// the edge itself takes part in the search for the lightest edge
+		cutDynamicMst(mst, edge);
+		mst->edgeList[edge].weight = weight;
+		replaceDynamicMst(mst, mst->edgeList[edge].from,
+				mst->edgeList[edge].to);
 	}
-
-	return handle;
 }
 
 /*
- * add edge to adjacency list
+ * apply the batches of edge updates of a file to the MST of the graph, lines
+ * "from to weight" insert an edge or change its weight, lines "from to" delete
+ * it and empty lines end a batch, prints the changed MST edges of every batch
+ * and stores the final MST
  */
-void pushAdjacencyList(AdjacencyList* list, const int from, const int to,
-		const int weight) {
-	List* lists[2] = { &list->lists[from], &list->lists[to] };
-	for (int i = 0; i < 2; i++) {
-		if (lists[i]->size == lists[i]->alloced) {
-			lists[i]->elements = (ListElement*) realloc(lists[i]->elements,
-					2 * lists[i]->alloced * sizeof(ListElement));
-			lists[i]->alloced *= 2;
+void updateMst(const WeightedGraph* graph, WeightedGraph* mst,
+		const char updateFileName[]) {
+	FILE* updateFile = fopen(updateFileName, "r");
+	if (updateFile == NULL) {
+		fprintf(stderr, "Couldn't open update file, exiting!\n");
+		exit(EXIT_FAILURE);
+	}
+
+	double lap = MPI_Wtime();
+	DynamicMst* dynamic = &(DynamicMst ) { .vertices = 0, .edges = 0,
+					.alloced = 0, .freeEdge = UNSET_ELEMENT, .weight = 0,
+					.edgeList = NULL, .inTree = NULL, .touched = NULL, .heads =
+					NULL, .next = NULL, .previous = NULL, .children = NULL,
+					.parents = NULL, .heaviest = NULL, .flipped = NULL,
+					.stack = NULL, .labels = NULL, .queue = NULL, .changes = 0,
+					.changesAlloced = 0, .changeList = NULL };
+	newDynamicMst(dynamic, graph, mst);
+	lapPhase(UPDATE_PHASE, &lap);
+
+	char* line = NULL;
+	size_t lineSize = 0;
+	ssize_t length;
+	long batch = 0;
+	long updates = 0;
+	do {
+		length = getline(&line, &lineSize, updateFile);
+		const char* position = line;
+		const char* end = length > 0 ? line + length : line;
+		Integer values[EDGE_MEMBERS];
+		int count = 0;
+		while (count < EDGE_MEMBERS && parseInteger(&position, end,
+				&values[count])) {
+			count++;
+		}
+		while (position < end && (*position == ' ' || *position == '\t'
+				|| *position == '\r' || *position == '\n')) {
+			position++;
+		}
+		if (position < end || count == 1 || (count > 1 && (values[0] < 0
+				|| values[0] >= graph->vertices || values[1] < 0
+				|| values[1] >= graph->vertices))
+				|| (count == EDGE_MEMBERS && (values[2] < WEIGHT_MINIMUM
+						|| values[2] > WEIGHT_MAXIMUM))) {
+			fprintf(stderr, "Malformed update file, exiting!\n");
+			exit(EXIT_FAILURE);
 		}
 
-		// add element at the end
-		if (i == 0) {
-			lists[i]->elements[lists[i]->size] = (ListElement ) { .vertex = to,
-							.weight = weight };
-		} else {
-			lists[i]->elements[lists[i]->size] = (ListElement ) {
-							.vertex = from, .weight = weight };
+		if (count == EDGE_MEMBERS) {
+			updateDynamicMst(dynamic, values[0], values[1], values[2]);
+			updates++;
+		} else if (count == 2) {
+			removeDynamicMst(dynamic, values[0], values[1]);
+			updates++;
+		} else if (updates > 0) {
+			// an empty line or the end of the file ends the batch
+			batch++;
+			double elapsed = profile.phases[UPDATE_PHASE];
+			lapPhase(UPDATE_PHASE, &lap);
+			printf("Batch %ld: %ld updates in %f s\n", batch, updates,
+					profile.phases[UPDATE_PHASE] - elapsed);
+			Integer changed = finishBatchDynamicMst(dynamic);
+			printf("MST edges changed: %" INTEGER_FORMAT "\n", changed);
+			printf("MST weight: %lu\n", dynamic->weight);
+			updates = 0;
+			lap = MPI_Wtime();
+		}
+	} while (length != -1);
+	printf("Time updating: %f s\n", profile.phases[UPDATE_PHASE]);
+
+	// the MST gets the edges of the final tree
+	mst->edges = 0;
+	mst->edgeList = (Edge*) realloc(mst->edgeList,
+			(graph->vertices > 1 ? graph->vertices - 1 : 1) * sizeof(Edge));
+	for (Integer i = 0; i < dynamic->edges; i++) {
+		if (dynamic->edgeList[i].from != UNSET_ELEMENT
+				&& getBit(dynamic->inTree, i)) {
+			mst->edgeList[mst->edges++] = dynamic->edgeList[i];
 		}
-		lists[i]->size++;
 	}
+
+	// clean up
+	free(line);
+	fclose(updateFile);
+	deleteDynamicMst(dynamic);
 }
 
 /*
- * push a new element to the end of a binary heap, then bubble up
+ * true if both endpoints of all edges are vertices of the graph
  */
-void pushBinaryMinHeap(BinaryMinHeap* heap, const int vertex, const int via,
-		const int weight) {
-	if (heap->size == heap->alloced) {
-		// double the size if heap is full
-		heap->elements = (BinaryHeapElement*) realloc(heap->elements,
-				2 * heap->alloced * sizeof(BinaryHeapElement));
-		heap->alloced *= 2;
+bool validEdges(const Edge* edgeList, const Integer edges,
+		const Integer vertices) {
+	bool valid = true;
+#pragma omp parallel for schedule(static) reduction(&&:valid)
+	for (Integer i = 0; i < edges; i++) {
+		valid = valid && edgeList[i].from >= 0 && edgeList[i].from < vertices
+				&& edgeList[i].to >= 0 && edgeList[i].to < vertices;
 	}
 
-	heap->elements[heap->size] = (BinaryHeapElement ) { .vertex = vertex, .via =
-					via, .weight = weight };
-	heap->positions[vertex] = heap->size;
-
-	heapifyBinaryMinHeap(heap, heap->size);
-
-	heap->size++;
+	return valid;
 }
 
 /*
- * add a new element
+ * write all edges of the graph in "from to weight" format, the lines are
+ * formatted into a large buffer which is written in blocks, returns false if
+ * writing failed
  */
-void pushFibonacciMinHeap(FibonacciMinHeap* heap, const int vertex,
-		const int via, const int weight) {
-	FibonacciHeapElement* element = (FibonacciHeapElement*) malloc(
-			sizeof(FibonacciHeapElement));
-	newFibonacciHeapElement(element, vertex, via, weight, element, element,
-	NULL, NULL);
-	heap->positions[element->vertex] = element;
+bool writeEdges(const WeightedGraph* graph, FILE* outputFile) {
+	// a line has at most three numbers of a sign and 19 digits with a tab
+	const size_t lineLength = EDGE_MEMBERS * 21 + 1;
+	char* buffer = (char*) malloc(OUTPUT_BUFFER_SIZE * sizeof(char));
+	size_t used = 0;
+	bool written = true;
+	for (Integer i = 0; i < graph->edges; i++) {
+		if (used + lineLength > (size_t) OUTPUT_BUFFER_SIZE) {
+			written = fwrite(buffer, sizeof(char), used, outputFile) == used
+					&& written;
+			used = 0;
+		}
+		const Edge* edge = &graph->edgeList[i];
+		used += formatInteger(&buffer[used], edge->from);
+		buffer[used++] = '\t';
+		used += formatInteger(&buffer[used], edge->to);
+		buffer[used++] = '\t';
+		used += formatInteger(&buffer[used], edge->weight);
+		buffer[used++] = '\t';
+		buffer[used++] = '\n';
+	}
+	written = fwrite(buffer, sizeof(char), used, outputFile) == used && written;
 
-	// insert as root element
-	insertFibonacciMinHeap(heap, element);
-	heap->size++;
+	// clean up
+	free(buffer);
+
+	return written;
 }
 
 /*
- * read a previously generated maze file and store it in the graph
+ * save the graph to a file in the binary format
  */
-void readGraphFile(WeightedGraph* graph, const char inputFileName[]) {
+void writeGraphFile(const WeightedGraph* graph, const char outputFileName[]) {
 	// open the file
-	FILE* inputFile;
-	const char* inputMode = "r";
-	inputFile = fopen(inputFileName, inputMode);
-	if (inputFile == NULL) {
-		fprintf(stderr, "Couldn't open input file, exiting!\n");
+	FILE* outputFile;
+	const char* outputMode = "wb";
+	outputFile = fopen(outputFileName, outputMode);
+	if (outputFile == NULL) {
+		fprintf(stderr, "Couldn't open output file, exiting!\n");
 		exit(EXIT_FAILURE);
 	}
 
-	int fscanfResult;
+	// header contains number of vertices and edges, followed by the edges
+	GraphFileHeader header = { .memberSize = sizeof(Integer), .weightSize =
+			sizeof(Weight), .vertices = graph->vertices, .edges = graph->edges };
+	memcpy(header.magic, BINARY_MAGIC, sizeof(BINARY_MAGIC));
+	size_t edges = graph->edges;
+	if (fwrite(&header, sizeof(GraphFileHeader), 1, outputFile) != 1
+			|| fwrite(graph->edgeList, sizeof(Edge), edges, outputFile)
+					!= edges) {
+		fprintf(stderr,
+				"Something went wrong during writing of graph file, exiting!\n");
+		fclose(outputFile);
+		exit(EXIT_FAILURE);
+	}
 
-	// first line contains number of vertices and edges
-	int vertices = 0;
-	int edges = 0;
-	fscanfResult = fscanf(inputFile, "%d %d", &vertices, &edges);
-	newWeightedGraph(graph, vertices, edges);
+	fclose(outputFile);
+}
 
-	// all lines after the first contain the edges
-	// values stored as "from to weight"
-	int from;
-	int to;
-	int weight;
-	for (int i = 0; i < edges; i++) {
-		fscanfResult = fscanf(inputFile, "%d %d %d", &from, &to, &weight);
-		graph->edgeList[i * EDGE_MEMBERS] = from;
-		graph->edgeList[i * EDGE_MEMBERS + 1] = to;
-		graph->edgeList[i * EDGE_MEMBERS + 2] = weight;
-		// EOF result of *scanf indicates an error
-		if (fscanfResult == EOF) {
-			fprintf(stderr,
-					"Something went wrong during reading of graph file, exiting!\n");
-			fclose(inputFile);
-			exit(EXIT_FAILURE);
+/*
+ * save the graph as a maze to a binary PBM image, the vertices and edges are
+ * white and the walls with a border around the maze black, the pixel rows are
+ * rendered in bands from a bitmap of the edges
+ */
+void writeMazeImage(const WeightedGraph* graph, const int rows,
+		const int columns, const char outputFileName[]) {
+	// open the file
+	FILE* outputFile = fopen(outputFileName, "wb");
+	if (outputFile == NULL) {
+		fprintf(stderr, "Couldn't open image file, exiting!\n");
+		exit(EXIT_FAILURE);
+	}
+
+	uint64_t* bitmap = (uint64_t*) calloc(
+			(2 * (size_t) (rows > 0 ? rows : 0) * (columns > 0 ? columns : 0)
+					+ 63) / 64 + 1, sizeof(uint64_t));
+	fillMazeBitmap(bitmap, graph, rows, columns);
+
+	// eight pixels per byte, the first one in the highest bit, 1 is black
+	long width = 2L * (columns > 0 ? columns : 0) + 1;
+	long height = 2L * (rows > 0 ? rows : 0) + 1;
+	long rowBytes = (width + 7) / 8;
+	long bandRows = OUTPUT_BUFFER_SIZE / rowBytes > 0 ?
+			OUTPUT_BUFFER_SIZE / rowBytes : 1;
+	unsigned char* band = (unsigned char*) malloc(
+			bandRows * rowBytes * sizeof(unsigned char));
+	bool written = fprintf(outputFile, "P4\n%ld %ld\n", width, height) > 0;
+	for (long bandStart = 0; bandStart < height; bandStart += bandRows) {
+		long bandEnd = bandStart + bandRows < height ?
+				bandStart + bandRows : height;
+		memset(band, 0, bandRows * rowBytes * sizeof(unsigned char));
+#pragma omp parallel for schedule(static)
+		for (long y = bandStart; y < bandEnd; y++) {
+			unsigned char* line = &band[(y - bandStart) * rowBytes];
+			for (long x = 0; x < width; x++) {
+				if (y == 0 || x == 0 || y == height - 1 || x == width - 1
+						|| !isMazePassage(bitmap, columns, y - 1, x - 1)) {
+					line[x / 8] |= 0x80 >> (x % 8);
+				}
+			}
 		}
+		size_t bytes = (bandEnd - bandStart) * rowBytes;
+		written = fwrite(band, sizeof(unsigned char), bytes, outputFile)
+				== bytes && written;
 	}
 
-	fclose(inputFile);
+	// clean up
+	free(band);
+	free(bitmap);
+	if (fclose(outputFile) != 0 || !written) {
+		fprintf(stderr,
+				"Something went wrong during writing of maze image, exiting!\n");
+		exit(EXIT_FAILURE);
+	}
 }
 
 /*
- * scatter the edge list of a graph
+ * save the MST to a file, in the binary format for names ending in .bin and
+ * otherwise as text with a "vertices edges" header like the graph files
  */
-void scatterEdgeList(int* edgeList, int* edgeListPart, const int elements,
-		int* elementsPart) {
-	int rank;
-	int size;
-	MPI_Comm_rank(MPI_COMM_WORLD, &rank);
-	MPI_Comm_size(MPI_COMM_WORLD, &size);
-
-	MPI_Scatter(edgeList, *elementsPart * EDGE_MEMBERS, MPI_INT, edgeListPart,
-			*elementsPart * EDGE_MEMBERS,
-			MPI_INT, 0, MPI_COMM_WORLD);
+void writeMstFile(const WeightedGraph* mst, const char outputFileName[]) {
+	size_t length = strlen(outputFileName);
+	if (length >= 4 && strcmp(&outputFileName[length - 4], ".bin") == 0) {
+		writeGraphFile(mst, outputFileName);
+		return;
+	}
 
-	if (rank == size - 1 && elements % *elementsPart != 0) {
-		// number of elements and processes isn't divisible without remainder
-		*elementsPart = elements % *elementsPart;
+	// open the file
+	FILE* outputFile = fopen(outputFileName, "w");
+	if (outputFile == NULL) {
+		fprintf(stderr, "Couldn't open output file, exiting!\n");
+		exit(EXIT_FAILURE);
 	}
 
-	if (elements / 2 + 1 < size && elements != size) {
-		if (rank == 0) {
-			fprintf(stderr, "Unsupported size/process combination, exiting!\n");
-		}
-		MPI_Finalize();
+	bool written = fprintf(outputFile, "%" INTEGER_FORMAT " %" INTEGER_FORMAT
+			"\n", mst->vertices, mst->edges) > 0 && writeEdges(mst, outputFile);
+	if (fclose(outputFile) != 0 || !written) {
+		fprintf(stderr,
+				"Something went wrong during writing of MST file, exiting!\n");
 		exit(EXIT_FAILURE);
 	}
 }
 
 /*
- * sort the edges of the graph in parallel with mergesort in parallel
+ * reduce the timings and counters of all processes, the first process writes
+ * their minimum, maximum, mean and sum to a JSON file (names ending in .json)
+ * or a CSV file
  */
-void sort(WeightedGraph* graph) {
+void writeTimingsFile(const char outputFileName[]) {
 	int rank;
 	int size;
-	MPI_Comm_rank(MPI_COMM_WORLD, &rank);
-	MPI_Comm_size(MPI_COMM_WORLD, &size);
-	MPI_Status status;
+	MPI_Comm_rank(MPI_COMM_GRAPH, &rank);
+	MPI_Comm_size(MPI_COMM_GRAPH, &size);
+
+	// the phases of the rounds follow the ones of the whole run
+	int rounds = profile.rounds < PROFILE_ROUNDS ?
+			profile.rounds : PROFILE_ROUNDS;
+	MPI_Allreduce(MPI_IN_PLACE, &rounds, 1, MPI_INT, MPI_MAX, MPI_COMM_GRAPH);
+	int timings = (rounds + 1) * PHASES;
+	double* times = (double*) calloc(4 * timings, sizeof(double));
+	memcpy(times, profile.phases, PHASES * sizeof(double));
+	memcpy(&times[PHASES], profile.roundPhases,
+			(profile.rounds < rounds ? profile.rounds : rounds) * PHASES
+					* sizeof(double));
+	double* minimum = &times[timings];
+	double* maximum = &times[2 * timings];
+	double* sum = &times[3 * timings];
+	MPI_Reduce(times, minimum, timings, MPI_DOUBLE, MPI_MIN, 0, MPI_COMM_GRAPH);
+	MPI_Reduce(times, maximum, timings, MPI_DOUBLE, MPI_MAX, 0, MPI_COMM_GRAPH);
+	MPI_Reduce(times, sum, timings, MPI_DOUBLE, MPI_SUM, 0, MPI_COMM_GRAPH);
+	uint64_t counters[3][COUNTERS];
+	MPI_Reduce(profile.counters, counters[0], COUNTERS, MPI_UINT64_T, MPI_MIN,
+			0, MPI_COMM_GRAPH);
+	MPI_Reduce(profile.counters, counters[1], COUNTERS, MPI_UINT64_T, MPI_MAX,
+			0, MPI_COMM_GRAPH);
+	MPI_Reduce(profile.counters, counters[2], COUNTERS, MPI_UINT64_T, MPI_SUM,
+			0, MPI_COMM_GRAPH);
 
-	bool parallel = size != 1;
-
-	// send number of elements
-	int elements;
 	if (rank == 0) {
-		elements = graph->edges;
-		MPI_Bcast(&elements, 1, MPI_INT, 0, MPI_COMM_WORLD);
-	} else {
-		MPI_Bcast(&elements, 1, MPI_INT, 0, MPI_COMM_WORLD);
-	}
-
-	// scatter the edges to sort
-	int elementsPart = (elements + size - 1) / size;
-	int* edgeListPart = (int*) malloc(
-			elementsPart * EDGE_MEMBERS * sizeof(int));
-	if (parallel) {
-		scatterEdgeList(graph->edgeList, edgeListPart, elements, &elementsPart);
-	} else {
-		edgeListPart = graph->edgeList;
-	}
-
-	// sort the part
-	mergeSort(edgeListPart, 0, elementsPart - 1);
+		FILE* outputFile = fopen(outputFileName, "w");
+		if (outputFile == NULL) {
+			fprintf(stderr, "Couldn't open timings file, exiting!\n");
+			exit(EXIT_FAILURE);
+		}
 
-	if (parallel) {
-		// merge all parts
-		int from;
-		int to;
-		int elementsRecieved;
-		for (int step = 1; step < size; step *= 2) {
-			if (rank % (2 * step) == 0) {
-				from = rank + step;
-				if (from < size) {
-					MPI_Recv(&elementsRecieved, 1, MPI_INT, from, 0,
-					MPI_COMM_WORLD, &status);
-					edgeListPart = realloc(edgeListPart,
-							(elementsPart + elementsRecieved) * EDGE_MEMBERS
-									* sizeof(int));
-					MPI_Recv(&edgeListPart[elementsPart * EDGE_MEMBERS],
-							elementsRecieved * EDGE_MEMBERS,
-							MPI_INT, from, 0, MPI_COMM_WORLD, &status);
-					merge(edgeListPart, 0, elementsPart + elementsRecieved - 1,
-							elementsPart - 1);
-					elementsPart += elementsRecieved;
+		size_t length = strlen(outputFileName);
+		if (length >= 5 && strcmp(&outputFileName[length - 5], ".json") == 0) {
+			fprintf(outputFile, "{\n\t\"processes\": %d,\n\t\"phases\": {\n",
+					size);
+			for (int i = 0; i < PHASES; i++) {
+				fprintf(outputFile, "\t\t\"%s\": { \"minimum\": %f, \"maximum\":"
+						" %f, \"mean\": %f, \"sum\": %f }%s\n", PHASE_NAMES[i],
+						minimum[i], maximum[i], sum[i] / size, sum[i],
+						i < PHASES - 1 ? "," : "");
+			}
+			fprintf(outputFile, "\t},\n\t\"rounds\": [\n");
+			for (int round = 0; round < rounds; round++) {
+				fprintf(outputFile, "\t\t{");
+				for (int i = SCAN_PHASE; i <= UNION_PHASE; i++) {
+					int timing = (round + 1) * PHASES + i;
+					fprintf(outputFile, " \"%s\": { \"minimum\": %f, \"maximum\":"
+							" %f, \"mean\": %f, \"sum\": %f }%s", PHASE_NAMES[i],
+							minimum[timing], maximum[timing], sum[timing] / size,
+							sum[timing], i < UNION_PHASE ? "," : " ");
 				}
-			} else if (rank % step == 0) {
-				to = rank - step;
-				MPI_Send(&elementsPart, 1, MPI_INT, to, 0, MPI_COMM_WORLD);
-				MPI_Send(edgeListPart, elementsPart * EDGE_MEMBERS, MPI_INT, to,
-						0,
-						MPI_COMM_WORLD);
+				fprintf(outputFile, "}%s\n", round < rounds - 1 ? "," : "");
 			}
-		}
-
-		// edgeListPart is the new edgeList of the graph, cleanup other memory
-		if (rank == 0) {
-			free(graph->edgeList);
-			graph->edgeList = edgeListPart;
+			fprintf(outputFile, "\t],\n\t\"counters\": {\n");
+			for (int i = 0; i < COUNTERS; i++) {
+				fprintf(outputFile, "\t\t\"%s\": { \"minimum\": %" PRIu64
+						", \"maximum\": %" PRIu64 ", \"mean\": %f, \"sum\": %"
+						PRIu64 " }%s\n", COUNTER_NAMES[i], counters[0][i],
+						counters[1][i], (double) counters[2][i] / size,
+						counters[2][i], i < COUNTERS - 1 ? "," : "");
+			}
+			fprintf(outputFile, "\t}\n}\n");
 		} else {
-			free(edgeListPart);
+			// one row per phase, per phase of a round and per counter
+			fprintf(outputFile, "section,round,name,minimum,maximum,mean,sum\n");
+			for (int i = 0; i < PHASES; i++) {
+				fprintf(outputFile, "phase,,%s,%f,%f,%f,%f\n", PHASE_NAMES[i],
+						minimum[i], maximum[i], sum[i] / size, sum[i]);
+			}
+			for (int round = 0; round < rounds; round++) {
+				for (int i = SCAN_PHASE; i <= UNION_PHASE; i++) {
+					int timing = (round + 1) * PHASES + i;
+					fprintf(outputFile, "round,%d,%s,%f,%f,%f,%f\n", round,
+							PHASE_NAMES[i], minimum[timing], maximum[timing],
+							sum[timing] / size, sum[timing]);
+				}
+			}
+			for (int i = 0; i < COUNTERS; i++) {
+				fprintf(outputFile, "counter,,%s,%" PRIu64 ",%" PRIu64 ",%f,%"
+						PRIu64 "\n", COUNTER_NAMES[i], counters[0][i],
+						counters[1][i], (double) counters[2][i] / size,
+						counters[2][i]);
+			}
 		}
-	} else {
-		graph->edgeList = edgeListPart;
-	}
-}
-
-/*
- * helper function to swap binary heap elements
- */
-void swapBinaryHeapElement(BinaryMinHeap* heap, const int position1,
-		const int position2) {
-	heap->positions[heap->elements[position1].vertex] = position2;
-	heap->positions[heap->elements[position2].vertex] = position1;
-
-	BinaryHeapElement swap = heap->elements[position1];
-	heap->elements[position1] = heap->elements[position2];
-	heap->elements[position2] = swap;
-}
-
-/*
- * merge the set of parent1 and parent2 with union by rank
- */
-void unionSet(Set* set, const int parent1, const int parent2) {
-	int root1 = findSet(set, parent1);
-	int root2 = findSet(set, parent2);
 
-	if (root1 == root2) {
-		return;
-	} else if (set->rank[root1] < set->rank[root2]) {
-		set->canonicalElements[root1] = root2;
-	} else if (set->rank[root1] > set->rank[root2]) {
-		set->canonicalElements[root2] = root1;
-	} else {
-		set->canonicalElements[root1] = root2;
-		set->rank[root2] = set->rank[root1] + 1;
+		fclose(outputFile);
 	}
+
+	// clean up
+	free(times);
 }